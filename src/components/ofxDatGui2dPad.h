@@ -34,7 +34,7 @@ class ofxDatGui2dPad : public ofxDatGuiComponent {
             mType = ofxDatGuiType::PAD2D;
             setTheme(ofxDatGuiComponent::getTheme());
             setBounds(ofRectangle(0, 0, ofGetWidth(), ofGetHeight()), true);
-            ofAddListener(ofEvents().windowResized, this, &ofxDatGui2dPad::onWindowResized);
+            ofxDatGuiInput::setResizeTarget(this, true);
         }
     
         ofxDatGui2dPad(string label, ofRectangle bounds) : ofxDatGuiComponent(label)
@@ -44,12 +44,7 @@ class ofxDatGui2dPad : public ofxDatGuiComponent {
             mType = ofxDatGuiType::PAD2D;
             setTheme(ofxDatGuiComponent::getTheme());
             setBounds(bounds, false);
-            ofAddListener(ofEvents().windowResized, this, &ofxDatGui2dPad::onWindowResized);
-        }
-    
-        ~ofxDatGui2dPad()
-        {
-            ofRemoveListener(ofEvents().windowResized, this, &ofxDatGui2dPad::onWindowResized);
+            ofxDatGuiInput::setResizeTarget(this, true);
         }
     
         void setTheme(const ofxDatGuiTheme* theme)
@@ -67,6 +62,7 @@ class ofxDatGui2dPad : public ofxDatGuiComponent {
     
         void setPoint(ofPoint pt)
         {
+            if (mInert) return;
             if (mBounds.inside(pt)){
                 mPercentX = (pt.x-mBounds.x) / mBounds.width;
                 mPercentY = (pt.y-mBounds.y) / mBounds.height;
@@ -83,6 +79,7 @@ class ofxDatGui2dPad : public ofxDatGuiComponent {
     
         void setBounds(ofRectangle bounds, bool scaleOnResize = false)
         {
+            if (mInert) return;
             mBounds = bounds;
             mScaleOnResize = scaleOnResize;
             setWorldCoordinates();
@@ -103,22 +100,22 @@ class ofxDatGui2dPad : public ofxDatGuiComponent {
         void draw()
         {
             if (!mVisible) return;
-            ofPushStyle();
+            ofxDatGuiRenderState::push();
                 mPad.x = x + mLabel.width;
                 mPad.y = y + mStyle.padding;
                 mPad.width = mStyle.width - mStyle.padding - mLabel.width;
                 mLocal.x = mPad.x + mPad.width * mPercentX;
                 mLocal.y = mPad.y + mPad.height * mPercentY;
                 ofxDatGuiComponent::draw();
-                ofSetColor(mColors.fill);
-                ofDrawRectangle(mPad);
-                ofSetLineWidth(mLineWeight);
-                ofSetColor(mColors.line);
+                ofxDatGuiRenderer::rect(mPad, mColors.fill);
+                ofxDatGuiRenderer::sync();
+                ofxDatGuiRenderState::setLineWidth(mLineWeight);
+                ofxDatGuiRenderState::setColor(mColors.line);
                 ofDrawLine(mPad.x, mLocal.y, mPad.x + mPad.width, mLocal.y);
                 ofDrawLine(mLocal.x, mPad.y, mLocal.x, mPad.y + mPad.height);
-                ofSetColor(mColors.ball);
+                ofxDatGuiRenderState::setColor(mColors.ball);
                 ofDrawCircle(mLocal, mBallSize);
-            ofPopStyle();
+            ofxDatGuiRenderState::pop();
         }
     
         void dispatchEvent()
@@ -135,10 +132,16 @@ class ofxDatGui2dPad : public ofxDatGuiComponent {
     
     protected:
     
+        void deliverEvent()
+        {
+            dispatchEvent();
+        }
+    
         void setWorldCoordinates()
         {
             mWorld.x = mBounds.x + (mBounds.width * mPercentX);
             mWorld.y = mBounds.y + (mBounds.height * mPercentY);
+            markDirty();
         }
     
         void onMouseDrag(ofPoint m)
@@ -147,12 +150,13 @@ class ofxDatGui2dPad : public ofxDatGuiComponent {
                 mPercentX = (m.x-mPad.x) / mPad.width;
                 mPercentY = (m.y-mPad.y) / mPad.height;
                 setWorldCoordinates();
-                dispatchEvent();
+                emitEvent();
             }
         }
     
-        void onWindowResized(ofResizeEventArgs &e)
+        void onWindowResized()
         {
+            ofxDatGuiComponent::onWindowResized();
         // scale the bounds to the resized window //
             if (mScaleOnResize){
                 mBounds.width *= (ofGetWidth() / mBounds.width);
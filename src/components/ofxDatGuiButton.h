@@ -52,20 +52,18 @@ class ofxDatGuiButton : public ofxDatGuiComponent {
         {
             if (mVisible) {
             // anything that extends ofxDatGuiButton has the same rollover effect //
-                ofPushStyle();
+                ofxDatGuiRenderState::push();
                     if (mStyle.border.visible) drawBorder();
-                    ofFill();
+                    ofColor bkgd = mStyle.color.background;
                     if (mFocused && mMouseDown){
-                        ofSetColor(mStyle.color.onMouseDown, mStyle.opacity);
+                        bkgd = mStyle.color.onMouseDown;
                     }   else if (mMouseOver){
-                        ofSetColor(mStyle.color.onMouseOver, mStyle.opacity);
-                    }   else{
-                        ofSetColor(mStyle.color.background, mStyle.opacity);
+                        bkgd = mStyle.color.onMouseOver;
                     }
-                    ofDrawRectangle(x, y, mStyle.width, mStyle.height);
+                    ofxDatGuiRenderer::rect(x, y, mStyle.width, mStyle.height, ofColor(bkgd, mStyle.opacity));
                     drawLabel();
                     if (mStyle.stripe.visible) drawStripe();
-                ofPopStyle();
+                ofxDatGuiRenderState::pop();
             }
         }
 
@@ -123,10 +121,13 @@ class ofxDatGuiToggle : public ofxDatGuiButton {
         void toggle()
         {
             mChecked = !mChecked;
+            markDirty();
         }
     
         void setChecked(bool check)
         {
+            if (mInert) return;
+            if (check != mChecked) markDirty();
             mChecked = check;
         }
     
@@ -138,15 +139,10 @@ class ofxDatGuiToggle : public ofxDatGuiButton {
         void draw()
         {
             if (mVisible) {
-                ofPushStyle();
+                ofxDatGuiRenderState::push();
                 ofxDatGuiButton::draw();
-                ofSetColor(mIcon.color);
-                if (mChecked == true){
-                    radioOn->draw(x+mIcon.x, y+mIcon.y, mIcon.size, mIcon.size);
-                }   else{
-                    radioOff->draw(x+mIcon.x, y+mIcon.y, mIcon.size, mIcon.size);
-                }
-                ofPopStyle();
+                ofxDatGuiRenderer::image(mChecked ? radioOn : radioOff, x+mIcon.x, y+mIcon.y, mIcon.size, mIcon.size, mIcon.color);
+                ofxDatGuiRenderState::pop();
             }
         }
     
@@ -28,6 +28,7 @@ public:
 
 	// Add a new button to the bar
 	ofxDatGuiButton * addButton(const std::string & label) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * btn = new ofxDatGuiButton(label);
 
 		// Use current theme + kill their own vertical stripe
@@ -39,6 +40,7 @@ public:
 
 		children.push_back(btn);
 		mButtons.push_back(btn);
+		adoptChild(btn);
 
 		layoutChildren();
 		return btn;
@@ -153,11 +155,13 @@ public:
 
 	// Select a button by index (shows stripe for this one, hides others).
 	void setSelectedIndex(int index) {
+		if (mInert) return;
 		if (index < 0 || index >= static_cast<int>(mButtons.size())) {
 			mSelectedIndex = -1;
 		} else {
 			mSelectedIndex = index;
 		}
+		markDirty();
 	}
 
 	int getSelectedIndex() const { return mSelectedIndex; }
@@ -185,6 +189,8 @@ private:
 
 	bool mRadioMode; // if true: one selected button at a time
 	int mSelectedIndex; // -1 = none
+	// buttons added later come from the pool this bar was created from
+	std::shared_ptr<ofxDatGuiPool> mAllocator = ofxDatGuiPool::current();
 
 	// Lay out the buttons in a single horizontal row.
 	// Lay out the buttons in a single horizontal row with even gaps.
@@ -255,10 +261,7 @@ private:
 		float sx = static_cast<float>(b.x);
 		float sy = static_cast<float>(b.y + b.h) - stripeH;
 
-		ofPushStyle();
-		ofSetColor(mStyle.stripe.color);
-		ofDrawRectangle(sx, sy, static_cast<float>(b.w), stripeH);
-		ofPopStyle();
+		ofxDatGuiRenderer::rect(sx, sy, static_cast<float>(b.w), stripeH, mStyle.stripe.color);
 	}
 
 	// Internal handler: called when any child button is clicked.
@@ -73,18 +73,21 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
     
         void setColor(ofColor color)
         {
+            if (mInert) return;
             mColor = color;
             setTextFieldInputColor();
         }
     
         void setColor(int hex)
         {
+            if (mInert) return;
             mColor = ofColor::fromHex(hex);
             setTextFieldInputColor();
         }
     
         void setColor(int r, int g, int b, int a = 255)
         {
+            if (mInert) return;
             mColor = ofColor(r, g, b, a);
             setTextFieldInputColor();
         }
@@ -97,7 +100,7 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
         void draw()
         {
             if (!mVisible) return;
-            ofPushStyle();
+            ofxDatGuiRenderState::push();
                 ofxDatGuiTextInput::draw();
                 if (mShowPicker) {
                     pickerRect.x = this->x + mLabel.width;
@@ -115,28 +118,41 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
                     gPoints[4] = ofVec2f(gradientRect.x, gradientRect.y+gradientRect.height);
                     gPoints[5] = ofVec2f(gradientRect.x, gradientRect.y);
                     vbo.setVertexData(&gPoints[0], 6, GL_DYNAMIC_DRAW );
-                    ofSetColor(pickerBorder);
+                    ofxDatGuiRenderer::sync();
+                    ofxDatGuiRenderState::setColor(pickerBorder);
                     ofDrawRectangle(pickerRect);
-                    ofSetColor(ofColor::white);
+                    ofxDatGuiRenderState::setColor(ofColor::white);
                     rainbow.image->draw(rainbow.rect);
                     vbo.draw( GL_TRIANGLE_FAN, 0, 6 );
                 }
-            ofPopStyle();
+            ofxDatGuiRenderState::pop();
         }
     
         void drawColorPicker()
         {
             if (mVisible && mShowPicker){
-                ofPushStyle();
-                    ofSetColor(pickerBorder);
+            // the picker covers the rows below us, their labels included //
+                ofxDatGuiRenderer::overlay();
+                ofxDatGuiRenderState::push();
+                    ofxDatGuiRenderState::setColor(pickerBorder);
                     ofDrawRectangle(pickerRect);
-                    ofSetColor(ofColor::white);
+                    ofxDatGuiRenderState::setColor(ofColor::white);
                     rainbow.image->draw(rainbow.rect);
                     vbo.draw( GL_TRIANGLE_FAN, 0, 6 );
-                ofPopStyle();
+                ofxDatGuiRenderState::pop();
             }
         }
     
+        ofRectangle getDrawBounds()
+        {
+        // include the picker when it's open as it overlaps the components below us //
+            ofRectangle bounds = ofxDatGuiComponent::getDrawBounds();
+            if (mVisible && mShowPicker){
+                bounds.growToInclude(ofRectangle(this->x + mLabel.width, this->y + mStyle.padding + mInput.getHeight(), mInput.getWidth(), pickerRect.height));
+            }
+            return bounds;
+        }
+    
         bool hitTest(ofPoint m)
         {
             if (mInput.hitTest(m)){
@@ -155,7 +171,7 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
                 }   else if (gradientRect.inside(m) && mMouseDown){
                     mColor = gColor;
                 // dispatch event out to main application //
-                    dispatchEvent();
+                    emitEvent();
                     setTextFieldInputColor();
                 }
                 return true;
@@ -178,9 +194,15 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
     
     protected:
     
+        void deliverEvent()
+        {
+            dispatchEvent();
+        }
+    
         void onMouseEnter(ofPoint mouse)
         {
             mShowPicker = true;
+            setPopupOpen(true);
             ofxDatGuiComponent::onFocus();
             ofxDatGuiComponent::onMouseEnter(mouse);
         }
@@ -188,6 +210,7 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
         void onMouseLeave(ofPoint mouse)
         {
             mShowPicker = false;
+            setPopupOpen(false);
             ofxDatGuiTextInput::onMouseLeave(mouse);
             if (!mInput.hasFocus()) ofxDatGuiComponent::onFocusLost();
         }
@@ -208,7 +231,7 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
             gColors[0] = ofColor(mColor.r/2, mColor.g/2, mColor.b/2);
             vbo.setColorData(&gColors[0], 6, GL_DYNAMIC_DRAW );
         // dispatch event out to main application //
-            dispatchEvent();
+            emitEvent();
         }
 
         inline void setTextFieldInputColor()
@@ -220,6 +243,7 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
             while(res.size() < 6) res+="0";
             mInput.setText(ofToUpper(res));
             updateTextFieldColors();
+            markDirty();
         }
     
     private:
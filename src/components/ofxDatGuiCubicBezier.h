@@ -104,6 +104,7 @@ public:
 		x2 = clamp01(_x2);
 		y2 = clamp01(_y2);
 		syncFieldsFromModel();
+		markDirty();
 		if (dispatch) dispatchEvent();
 	}
 
@@ -123,12 +124,6 @@ public:
 		return ss.str();
 	}
 
-	/// Register for value change events: ofxDatGuiCubicBezierEvent(this,x1,y1,x2,y2)
-	template <class Listener>
-	void onCubicBezierEvent(Listener * owner, void (Listener::*fn)(ofxDatGuiCubicBezierEvent)) {
-		cubicBezierEventCallback = std::bind(fn, owner, std::placeholders::_1);
-	}
-
 	// --- Lifecycle ----------------------------------------------------------
 
 	void update(bool acceptEvents = true) override {
@@ -142,21 +137,24 @@ public:
 		if (!mVisible) return;
 		ofxDatGuiComponent::draw();
 
+		// Pad, grid and curve are immediate mode: flush the batched quads first.
+		ofxDatGuiRenderer::sync();
+
 		// Pad.
-		ofPushStyle();
-		ofFill();
-		ofSetColor(mColors.fill);
+		ofxDatGuiRenderState::push();
+		ofxDatGuiRenderState::fill();
+		ofxDatGuiRenderState::setColor(mColors.fill);
 		ofDrawRectangle(mPad);
 
 		// Grid & axes.
-		ofSetColor(mColors.grid);
+		ofxDatGuiRenderState::setColor(mColors.grid);
 		for (int i = 1; i < 4; ++i) {
 			float t = i / 4.f;
 			ofDrawLine(mPad.x + t * mPad.width, mPad.y, mPad.x + t * mPad.width, mPad.y + mPad.height);
 			ofDrawLine(mPad.x, mPad.y + t * mPad.height, mPad.x + mPad.width, mPad.y + t * mPad.height);
 		}
-		ofNoFill();
-		ofSetColor(mColors.axis);
+		ofxDatGuiRenderState::noFill();
+		ofxDatGuiRenderState::setColor(mColors.axis);
 		ofDrawRectangle(mPad);
 
 		// Control points (CSS y flipped in screen space).
@@ -166,11 +164,11 @@ public:
 		const ofPoint P3s = normToScreen({ 1, 0 });
 
 		// Tangents & curve.
-		ofSetColor(255, 70);
+		ofxDatGuiRenderState::setColor(ofColor(255, 70));
 		ofDrawLine(P0s, P1s);
 		ofDrawLine(P2s, P3s);
-		ofSetColor(mColors.curve);
-		ofSetLineWidth(mCurveThickness);
+		ofxDatGuiRenderState::setColor(mColors.curve);
+		ofxDatGuiRenderState::setLineWidth(mCurveThickness);
 		ofPolyline pl;
 		for (int i = 0; i <= 64; ++i)
 			pl.addVertex(cubic(P0s, P1s, P2s, P3s, i / 64.f));
@@ -179,7 +177,7 @@ public:
 		// Handles.
 		drawHandle(P1s, dragging == Dragging::P1);
 		drawHandle(P2s, dragging == Dragging::P2);
-		ofPopStyle();
+		ofxDatGuiRenderState::pop();
 
 		// Inputs.
 		inX1.draw();
@@ -322,8 +320,6 @@ private:
 		ofColor fill, grid, axis, curve, handle, handleHL;
 	} mColors;
 
-	std::function<void(ofxDatGuiCubicBezierEvent)> cubicBezierEventCallback = nullptr;
-
 	// --- Helpers ------------------------------------------------------------
 
 	static float clamp01(float v) { return v < 0 ? 0 : (v > 1 ? 1 : v); }
@@ -352,14 +348,14 @@ private:
 	}
 
 	void drawHandle(const ofPoint & p, bool highlight) {
-		ofPushStyle();
-		ofFill();
-		ofSetColor(highlight ? mColors.handleHL : mColors.handle);
+		ofxDatGuiRenderState::push();
+		ofxDatGuiRenderState::fill();
+		ofxDatGuiRenderState::setColor(highlight ? mColors.handleHL : mColors.handle);
 		ofDrawCircle(p, mHandleRadius);
-		ofNoFill();
-		ofSetColor(0, 50);
+		ofxDatGuiRenderState::noFill();
+		ofxDatGuiRenderState::setColor(ofColor(0, 50));
 		ofDrawCircle(p, mHandleRadius + 2);
-		ofPopStyle();
+		ofxDatGuiRenderState::pop();
 	}
 
 	// Height = outer padding + inner padding + pad + gaps + inputs.
@@ -480,7 +476,11 @@ private:
 	}
 
 	void dispatchEvent() {
-		if (!cubicBezierEventCallback) return;
+		if (!cubicBezierEventCallback) {
+			// forwarded to a folder or gui that has no listener //
+			if (cubicBezierEventCallback.forwarding()) ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
+			return;
+		}
 		cubicBezierEventCallback(ofxDatGuiCubicBezierEvent(this, x1, y1, x2, y2));
 	}
 };
@@ -150,6 +150,7 @@ public:
 			points.push_back(clamp01(p));
 		rebuildRows();
 		recomputeTotalHeight();
+		markDirty();
 		if (dispatch) dispatchEvent();
 	}
 
@@ -218,17 +219,6 @@ public:
 		return path;
 	}
 
-	/**
-     * @brief Register a change callback.
-     * @tparam Listener      Class type of the listener.
-     * @param owner          Pointer to listener instance.
-     * @param fn             Member function taking (ofxDatGuiCurveEditorEvent).
-     */
-	template <class Listener>
-	void onCurveEditorEvent(Listener * owner, void (Listener::*fn)(ofxDatGuiCurveEditorEvent)) {
-		curveEventCallback = std::bind(fn, owner, std::placeholders::_1);
-	}
-
 	// -------------------------------------------------------------------------
 	// Lifecycle
 	// -------------------------------------------------------------------------
@@ -266,28 +256,29 @@ public:
 		// 3) Header label (keep it like RadioGroup)
 		drawLabel();
 
-		// 4) Pad, grid, axes
-		ofPushStyle();
-		ofFill();
-		ofSetColor(colors.fill);
+		// 4) Pad, grid, axes (immediate mode, so flush the batched quads first)
+		ofxDatGuiRenderer::sync();
+		ofxDatGuiRenderState::push();
+		ofxDatGuiRenderState::fill();
+		ofxDatGuiRenderState::setColor(colors.fill);
 		ofDrawRectangle(pad);
 
-		ofSetColor(colors.grid);
+		ofxDatGuiRenderState::setColor(colors.grid);
 		for (int i = 1; i < 4; ++i) {
 			float t = i / 4.f;
 			ofDrawLine(pad.x + t * pad.width, pad.y, pad.x + t * pad.width, pad.y + pad.height);
 			ofDrawLine(pad.x, pad.y + t * pad.height, pad.x + pad.width, pad.y + t * pad.height);
 		}
-		ofNoFill();
-		ofSetColor(colors.axis);
+		ofxDatGuiRenderState::noFill();
+		ofxDatGuiRenderState::setColor(colors.axis);
 		ofDrawRectangle(pad);
 
 		// Curve (polyline through normalized points; drawn with screen-style Y)
 		ofPolyline pl;
 		for (auto & p : points)
 			pl.addVertex(normToScreen({ p.x, 1.f - p.y }));
-		ofSetColor(colors.curve);
-		ofSetLineWidth(curveThickness);
+		ofxDatGuiRenderState::setColor(colors.curve);
+		ofxDatGuiRenderState::setLineWidth(curveThickness);
 		pl.draw();
 
 		// Handles
@@ -295,7 +286,7 @@ public:
 			auto s = normToScreen({ points[i].x, 1.f - points[i].y });
 			drawHandle(s, draggingIdx == (int)i);
 		}
-		ofPopStyle();
+		ofxDatGuiRenderState::pop();
 
 		// 5) Inputs & add button
 		for (auto & r : rows) {
@@ -466,8 +457,6 @@ private:
 		ofColor fill, grid, axis, curve, handle, handleHL;
 	} colors;
 
-	std::function<void(ofxDatGuiCurveEditorEvent)> curveEventCallback = nullptr;
-
 	// -------------------------------------------------------------------------
 	// Helpers
 	// -------------------------------------------------------------------------
@@ -513,14 +502,14 @@ private:
 
 	/// Handle rendering with subtle halo when highlighted.
 	void drawHandle(const ofPoint & p, bool highlight) {
-		ofPushStyle();
-		ofFill();
-		ofSetColor(highlight ? ofColor::white : colors.handle);
+		ofxDatGuiRenderState::push();
+		ofxDatGuiRenderState::fill();
+		ofxDatGuiRenderState::setColor(highlight ? ofColor::white : colors.handle);
 		ofDrawCircle(p, handleRadius);
-		ofNoFill();
-		ofSetColor(0, 50);
+		ofxDatGuiRenderState::noFill();
+		ofxDatGuiRenderState::setColor(ofColor(0, 50));
 		ofDrawCircle(p, handleRadius + 2);
-		ofPopStyle();
+		ofxDatGuiRenderState::pop();
 	}
 
 	/**
@@ -689,9 +678,19 @@ private:
 		rebuildRows();
 	}
 
-	/// Emit the change event if a callback is registered.
+	/// Report a change, delivered according to the delivery policy.
 	void dispatchEvent() {
-		if (!curveEventCallback) return;
-		curveEventCallback(ofxDatGuiCurveEditorEvent(this, points));
+		markDirty();
+		emitEvent();
+	}
+
+	/// Emit the change event with the current points if a callback is registered.
+	void deliverEvent() override {
+		if (!curveEditorEventCallback) {
+			// forwarded to a folder or gui that has no listener //
+			if (curveEditorEventCallback.forwarding()) ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
+			return;
+		}
+		curveEditorEventCallback(ofxDatGuiCurveEditorEvent(this, points));
 	}
 };
@@ -67,12 +67,14 @@ public:
 
 	void setWidth(int width, float labelWidth = 1) override {
 		ofxDatGuiComponent::setWidth(width, labelWidth);
+		mLayoutDirty = true;
 		mLabel.width = mStyle.width;
 		mLabel.rightAlignedXpos = mIcon.x - mLabel.margin;
 		ofxDatGuiComponent::positionLabel();
 	}
 
 	void select(int cIndex) {
+		if (mInert) return;
 		if (cIndex < 0 || cIndex >= static_cast<int>(children.size())) {
 			ofLogError() << "ofxDatGuiDropdown->select(" << cIndex << ") out of range";
 			return;
@@ -123,9 +125,10 @@ private:
 // --- Folder helper to add dropdowns (definition) ---
 inline ofxDatGuiDropdown * ofxDatGuiFolder::addDropdown(std::string label,
 	const std::vector<std::string> & options) {
+	ofxDatGuiPool::Scope alloc(mAllocator);
 	auto * dd = new ofxDatGuiDropdown(std::move(label), options);
 	dd->setStripeColor(mStyle.stripe.color);
-	dd->onDropdownEvent(this, &ofxDatGuiFolder::dispatchDropdownEvent);
+	dd->forwardEvents(this);
 	attachItem(dd);
 	return dd;
 }
@@ -8,7 +8,9 @@
 #include "ofxDatGuiButton.h"
 #include "ofxDatGuiColorPicker.h"
 #include "ofxDatGuiFRM.h"
+#include "ofxDatGuiStatsMonitor.h"
 #include "ofxDatGuiLabel.h"
+#include "ofxDatGuiLookupIndex.h"
 #include "ofxDatGuiMatrix.h"
 #include "ofxDatGuiScrollView.h"
 #include "ofxDatGuiSlider.h"
@@ -50,13 +52,29 @@ public:
 
 	~ofxDatGuiGroup() {
 		// delete non-picker children (pickers are managed by shared_ptrs in folders)
+		// and stop the pickers forwarding their events to this group
 		for (auto i : children)
 			if (i->getType() != ofxDatGuiType::COLOR_PICKER) delete i;
-	}
-
-	void setPosition(int x, int y) {
-		ofxDatGuiComponent::setPosition(x, y);
-		layout();
+			else i->unforwardEvents(this);
+	}
+
+	void setPosition(int px, int py) {
+		const int dx = px - x;
+		const int dy = py - y;
+		x = px;
+		y = py;
+		// a child that changed height since the last layout (without telling us) needs a real layout
+		if (mLayoutDirty || childrenResized()) {
+			layout();
+			return;
+		}
+		// nothing inside changed, carry the existing layout along instead of redoing it
+		if (dx == 0 && dy == 0) return;
+		for (auto c : children) {
+			if (!c->getVisible()) continue;
+			c->setPosition(c->getX() + dx, c->getY() + dy);
+		}
+		mChildIndex.translate(dy);
 	}
 
 	void expand() {
@@ -82,44 +100,61 @@ public:
 	void draw() {
 		if (!mVisible) return;
 
-		ofPushStyle();
+		ofxDatGuiRenderState::push();
 		ofxDatGuiButton::draw();
 
 		if (mIsExpanded) {
 			int mh = mStyle.height;
-			ofSetColor(mStyle.guiBackground, mStyle.opacity);
-			ofDrawRectangle(x, y + mh, mStyle.width, mStyle.vMargin);
+			const ofColor spacer(mStyle.guiBackground, mStyle.opacity);
+			ofxDatGuiRenderer::rect(x, y + mh, mStyle.width, mStyle.vMargin, spacer);
 
 			for (int i = 0; i < (int)children.size(); i++) {
 				mh += mStyle.vMargin;
+				OFX_DATGUI_PROFILE_COMPONENT(children[i], DRAW);
 				children[i]->draw();
 				mh += children[i]->getHeight();
 				if (i == (int)children.size() - 1) break;
-				ofSetColor(mStyle.guiBackground, mStyle.opacity);
-				ofDrawRectangle(x, y + mh, mStyle.width, mStyle.vMargin);
+				ofxDatGuiRenderer::rect(x, y + mh, mStyle.width, mStyle.vMargin, spacer);
 			}
 
-			ofSetColor(mIcon.color);
-			mIconOpen->draw(x + mIcon.x, y + mIcon.y, mIcon.size, mIcon.size);
+			ofxDatGuiRenderer::image(mIconOpen, x + mIcon.x, y + mIcon.y, mIcon.size, mIcon.size, mIcon.color);
 
 			for (int i = 0; i < (int)children.size(); i++)
 				children[i]->drawColorPicker();
 		} else {
-			ofSetColor(mIcon.color);
-			mIconClosed->draw(x + mIcon.x, y + mIcon.y, mIcon.size, mIcon.size);
+			ofxDatGuiRenderer::image(mIconClosed, x + mIcon.x, y + mIcon.y, mIcon.size, mIcon.size, mIcon.color);
 		}
-		ofPopStyle();
+		ofxDatGuiRenderState::pop();
 	}
 
 protected:
 	void layout() {
 		mHeight = mStyle.height + mStyle.vMargin;
+		// collapsed groups keep an empty (but active) index, their children see no input
+		mChildIndex.reset();
 		for (int i = 0; i < (int)children.size(); i++) {
 			if (!children[i]->getVisible()) continue;
 			children[i]->setPosition(x, y + mHeight);
-			if (mIsExpanded) mHeight += children[i]->getHeight() + mStyle.vMargin;
+			if (mIsExpanded) {
+				mChildIndex.add(children[i], y + mHeight, y + mHeight + children[i]->getHeight());
+				mHeight += children[i]->getHeight() + mStyle.vMargin;
+			}
 			if (i == (int)children.size() - 1) mHeight -= mStyle.vMargin;
 		}
+		mLayoutDirty = false;
+		ofxDatGuiInput::invalidate();
+	}
+
+	// true when the visible children no longer match the rows they were laid out as
+	bool childrenResized() {
+		if (!mIsExpanded) return false;
+		size_t row = 0;
+		for (auto c : children) {
+			if (!c->getVisible()) continue;
+			if (row >= mChildIndex.size() || mChildIndex.component(row) != c || mChildIndex.height(row) != c->getHeight()) return true;
+			row++;
+		}
+		return row != mChildIndex.size();
 	}
 
 	inline bool pointInHeader(const ofPoint & m) const {
@@ -162,11 +197,23 @@ protected:
 	}
 
 	void dispatchInternalEvent(ofxDatGuiInternalEvent e) {
-		if (e.type == ofxDatGuiEventType::VISIBILITY_CHANGED) layout();
-		internalEventCallback(e);
+		// a child changed size, our own height follows; the parent only needs to know
+		// that this group (at our index, not the child's) changed
+		if (e.type == ofxDatGuiEventType::VISIBILITY_CHANGED || e.type == ofxDatGuiEventType::GROUP_TOGGLED) {
+			// while batching the group is laid out (and tells its parent) once the batch closes
+			if (mBatchDepth > 0) {
+				mLayoutDirty = true;
+				return;
+			}
+			layout();
+			e = ofxDatGuiInternalEvent(e.type, mIndex);
+		}
+		if (internalEventCallback != nullptr) internalEventCallback(e);
 	}
 
 	int mHeight = 0;
+	int mBatchDepth = 0;
+	bool mLayoutDirty = true;
 	shared_ptr<ofImage> mIconOpen;
 	shared_ptr<ofImage> mIconClosed;
 
@@ -201,6 +248,7 @@ public:
 
 	void setWidth(int width, float labelWidth = 1) override {
 		ofxDatGuiComponent::setWidth(width, labelWidth);
+		mLayoutDirty = true;
 		mLabel.width = mStyle.width;
 		mLabel.rightAlignedXpos = mIcon.x - mLabel.margin;
 		ofxDatGuiComponent::positionLabel();
@@ -211,118 +259,19 @@ public:
 			pickers[i]->drawColorPicker();
 	}
 
-	// Event dispatchers
-	void dispatchButtonEvent(ofxDatGuiButtonEvent e) {
-		if (buttonEventCallback)
-			buttonEventCallback(e);
-		else
-			ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-	}
-	void dispatchToggleEvent(ofxDatGuiToggleEvent e) {
-		if (toggleEventCallback)
-			toggleEventCallback(e);
-		else if (buttonEventCallback)
-			buttonEventCallback(ofxDatGuiButtonEvent(e.target));
-		else
-			ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-	}
-	void dispatchSliderEvent(ofxDatGuiSliderEvent e) {
-		if (sliderEventCallback)
-			sliderEventCallback(e);
-		else
-			ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-	}
-	void dispatchTextInputEvent(ofxDatGuiTextInputEvent e) {
-		if (textInputEventCallback)
-			textInputEventCallback(e);
-		else
-			ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-	}
-	void dispatchColorPickerEvent(ofxDatGuiColorPickerEvent e) {
-		if (colorPickerEventCallback)
-			colorPickerEventCallback(e);
-		else
-			ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-	}
-	void dispatch2dPadEvent(ofxDatGui2dPadEvent e) {
-		if (pad2dEventCallback)
-			pad2dEventCallback(e);
-		else
-			ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-	}
-	void dispatchMatrixEvent(ofxDatGuiMatrixEvent e) {
-		if (matrixEventCallback)
-			matrixEventCallback(e);
-		else
-			ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-	}
-	void dispatchCubicBezierEvent(ofxDatGuiCubicBezierEvent e) {
-		if (cubicBezierEventCallback)
-			cubicBezierEventCallback(e);
-		else
-			ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-	}
-	void dispatchCurveEditorEvent(ofxDatGuiCurveEditorEvent e) {
-		if (curveEditorEventCallback)
-			curveEditorEventCallback(e);
-		else
-			ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-	}
-
-	// RadioGroup event bridge
-	using RadioGroupCB = std::function<void(ofxDatGuiRadioGroupEvent)>;
-
-	template <typename T>
-	void onRadioGroupEvent(T * listener, void (T::*handler)(ofxDatGuiRadioGroupEvent)) {
-		radioGroupEventCallback = std::bind(handler, listener, std::placeholders::_1);
-	}
-	void onRadioGroupEvent(RadioGroupCB cb) { radioGroupEventCallback = std::move(cb); }
-
-	void dispatchRadioGroupEvent(ofxDatGuiRadioGroupEvent e) {
-		if (radioGroupEventCallback)
-			radioGroupEventCallback(e);
-		else
-			ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-	}
-
-	// Dropdown event bridge
-	using ofxDatGuiInteractiveObject::onDropdownEvent;
-
-
-	using DropdownCB = std::function<void(ofxDatGuiDropdownEvent)>;
-	template <typename T>
-	void onDropdownEvent(T * listener, void (T::*handler)(ofxDatGuiDropdownEvent)) {
-		dropdownEventCallback = std::bind(handler, listener, std::placeholders::_1);
-	}
-	void onDropdownEvent(DropdownCB cb) { dropdownEventCallback = std::move(cb); }
-	void dispatchDropdownEvent(ofxDatGuiDropdownEvent e) {
-		if (dropdownEventCallback)
-			dropdownEventCallback(e);
-		else
-			ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-	}
-
 	// Adders
 	ofxDatGuiFolder * addFolder(string label, ofColor color = ofColor::white) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * sub = new ofxDatGuiFolder(label, color);
 		sub->setStripeColor(mStyle.stripe.color);
-		sub->onButtonEvent(this, &ofxDatGuiFolder::dispatchButtonEvent);
-		sub->onToggleEvent(this, &ofxDatGuiFolder::dispatchToggleEvent);
-		sub->onSliderEvent(this, &ofxDatGuiFolder::dispatchSliderEvent);
-		sub->onTextInputEvent(this, &ofxDatGuiFolder::dispatchTextInputEvent);
-		sub->onColorPickerEvent(this, &ofxDatGuiFolder::dispatchColorPickerEvent);
-		sub->on2dPadEvent(this, &ofxDatGuiFolder::dispatch2dPadEvent);
-		sub->onMatrixEvent(this, &ofxDatGuiFolder::dispatchMatrixEvent);
-		sub->onInternalEvent(this, &ofxDatGuiFolder::dispatchInternalEvent);
-		sub->onRadioGroupEvent(this, &ofxDatGuiFolder::dispatchRadioGroupEvent);
-		sub->onCubicBezierEvent(this, &ofxDatGuiFolder::dispatchCubicBezierEvent);
-		sub->onCurveEditorEvent(this, &ofxDatGuiFolder::dispatchCurveEditorEvent);
+		sub->forwardEvents(this);
 
 		attachItem(sub);
 		return sub;
 	}
 
 	ofxDatGuiLabel * addLabel(string label) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * lbl = new ofxDatGuiLabel(label);
 		lbl->setStripeColor(mStyle.stripe.color);
 		attachItem(lbl);
@@ -330,17 +279,19 @@ public:
 	}
 
 	ofxDatGuiButton * addButton(string label) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * button = new ofxDatGuiButton(label);
 		button->setStripeColor(mStyle.stripe.color);
-		button->onButtonEvent(this, &ofxDatGuiFolder::dispatchButtonEvent);
+		button->forwardEvents(this);
 		attachItem(button);
 		return button;
 	}
 
 	ofxDatGuiToggle * addToggle(string label, bool enabled = false) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * toggle = new ofxDatGuiToggle(label, enabled);
 		toggle->setStripeColor(mStyle.stripe.color);
-		toggle->onToggleEvent(this, &ofxDatGuiFolder::dispatchToggleEvent);
+		toggle->forwardEvents(this);
 		attachItem(toggle);
 		return toggle;
 	}
@@ -349,45 +300,70 @@ public:
 		return addSlider(label, min, max, (max + min) / 2);
 	}
 	ofxDatGuiSlider * addSlider(string label, float min, float max, double val) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * slider = new ofxDatGuiSlider(label, min, max, val);
 		slider->setStripeColor(mStyle.stripe.color);
-		slider->onSliderEvent(this, &ofxDatGuiFolder::dispatchSliderEvent);
+		slider->forwardEvents(this);
 		attachItem(slider);
 		return slider;
 	}
 	ofxDatGuiSlider * addSlider(ofParameter<int> & p) {
-		auto * slider = new ofxDatGuiSlider(p);
+		// int parameters take the exact integer path
+		ofxDatGuiPool::Scope alloc(mAllocator);
+		ofxDatGuiSlider * slider = new ofxDatGuiSliderT<int>(p);
 		slider->setStripeColor(mStyle.stripe.color);
-		slider->onSliderEvent(this, &ofxDatGuiFolder::dispatchSliderEvent);
+		slider->forwardEvents(this);
 		attachItem(slider);
 		return slider;
 	}
 	ofxDatGuiSlider * addSlider(ofParameter<float> & p) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * slider = new ofxDatGuiSlider(p);
 		slider->setStripeColor(mStyle.stripe.color);
-		slider->onSliderEvent(this, &ofxDatGuiFolder::dispatchSliderEvent);
+		slider->forwardEvents(this);
+		attachItem(slider);
+		return slider;
+	}
+	template <typename T>
+	ofxDatGuiSliderT<T> * addSliderT(string label, T min, T max, T val) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
+		auto * slider = new ofxDatGuiSliderT<T>(label, min, max, val);
+		slider->setStripeColor(mStyle.stripe.color);
+		slider->forwardEvents(this);
+		attachItem(slider);
+		return slider;
+	}
+	template <typename T>
+	ofxDatGuiSliderT<T> * addSliderT(ofParameter<T> & p) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
+		auto * slider = new ofxDatGuiSliderT<T>(p);
+		slider->setStripeColor(mStyle.stripe.color);
+		slider->forwardEvents(this);
 		attachItem(slider);
 		return slider;
 	}
 
 	ofxDatGuiTextInput * addTextInput(string label, string value) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * input = new ofxDatGuiTextInput(label, value);
 		input->setStripeColor(mStyle.stripe.color);
-		input->onTextInputEvent(this, &ofxDatGuiFolder::dispatchTextInputEvent);
+		input->forwardEvents(this);
 		attachItem(input);
 		return input;
 	}
 
 	ofxDatGuiColorPicker * addColorPicker(string label, ofColor color = ofColor::black) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		std::shared_ptr<ofxDatGuiColorPicker> picker(new ofxDatGuiColorPicker(label, color));
 		picker->setStripeColor(mStyle.stripe.color);
-		picker->onColorPickerEvent(this, &ofxDatGuiFolder::dispatchColorPickerEvent);
+		picker->forwardEvents(this);
 		attachItem(picker.get());
 		pickers.push_back(picker);
 		return picker.get();
 	}
 
 	ofxDatGuiFRM * addFRM(float refresh = 1.0f) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * monitor = new ofxDatGuiFRM(refresh);
 		monitor->setStripeColor(mStyle.stripe.color);
 		attachItem(monitor);
@@ -395,28 +371,32 @@ public:
 	}
 
 	ofxDatGuiBreak * addBreak() {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * brk = new ofxDatGuiBreak();
 		attachItem(brk);
 		return brk;
 	}
 
 	ofxDatGui2dPad * add2dPad(string label) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * pad = new ofxDatGui2dPad(label);
 		pad->setStripeColor(mStyle.stripe.color);
-		pad->on2dPadEvent(this, &ofxDatGuiFolder::dispatch2dPadEvent);
+		pad->forwardEvents(this);
 		attachItem(pad);
 		return pad;
 	}
 
 	ofxDatGuiMatrix * addMatrix(string label, int numButtons, bool showLabels = false) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * matrix = new ofxDatGuiMatrix(label, numButtons, showLabels);
 		matrix->setStripeColor(mStyle.stripe.color);
-		matrix->onMatrixEvent(this, &ofxDatGuiFolder::dispatchMatrixEvent);
+		matrix->forwardEvents(this);
 		attachItem(matrix);
 		return matrix;
 	}
 
 	ofxDatGuiWaveMonitor * addWaveMonitor(string label, float frequency, float amplitude) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * monitor = new ofxDatGuiWaveMonitor(label, frequency, amplitude);
 		monitor->setStripeColor(mStyle.stripe.color);
 		attachItem(monitor);
@@ -424,26 +404,37 @@ public:
 	}
 
 	ofxDatGuiValuePlotter * addValuePlotter(string label, float min, float max) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * plotter = new ofxDatGuiValuePlotter(label, min, max);
 		plotter->setStripeColor(mStyle.stripe.color);
 		attachItem(plotter);
 		return plotter;
 	}
 
+	ofxDatGuiMultiPlotter * addMultiPlotter(string label, float min, float max) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
+		auto * plotter = new ofxDatGuiMultiPlotter(label, min, max);
+		plotter->setStripeColor(mStyle.stripe.color);
+		attachItem(plotter);
+		return plotter;
+	}
+
 	ofxDatGuiCubicBezier * addCubicBezier(string label,
 		float x1 = 0.25f, float y1 = 0.1f,
 		float x2 = 0.25f, float y2 = 1.0f) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * bez = new ofxDatGuiCubicBezier(label, x1, y1, x2, y2);
 		bez->setStripeColor(mStyle.stripe.color);
-		bez->onCubicBezierEvent(this, &ofxDatGuiFolder::dispatchCubicBezierEvent);
+		bez->forwardEvents(this);
 		attachItem(bez);
 		return bez;
 	}
 
 	    ofxDatGuiCurveEditor * addCurveEditor(string label, float padAspect = 1.0f) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * ce = new ofxDatGuiCurveEditor(label, padAspect);
 		ce->setStripeColor(mStyle.stripe.color);
-		ce->onCurveEditorEvent(this, &ofxDatGuiFolder::dispatchCurveEditorEvent);
+		ce->forwardEvents(this);
 		attachItem(ce);
 		return ce;
 	}
@@ -459,9 +450,10 @@ public:
 
 
 	ofxDatGuiRadioGroup * addRadioGroup(const std::string & label, const std::vector<std::string> & options) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * rg = new ofxDatGuiRadioGroup(label, options);
 		rg->setStripeColor(mStyle.stripe.color);
-		rg->onRadioGroupEvent(this, &ofxDatGuiFolder::dispatchRadioGroupEvent);
+		rg->forwardEvents(this);
 		attachItem(rg);
 		return rg;
 	}
@@ -469,6 +461,7 @@ public:
 	ofxDatGuiDropdown * addDropdown(std::string label, const std::vector<std::string> & options);
 
 	ofxDatGuiPanel * addPanel(ofxDatGuiPanel::Orientation orientation = ofxDatGuiPanel::Orientation::VERTICAL) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * p = new ofxDatGuiPanel(orientation);
 		p->setStripeColor(mStyle.stripe.color);
 		attachItem(p);
@@ -480,11 +473,40 @@ public:
 		item->setIndex((int)children.size());
 		item->onInternalEvent(this, &ofxDatGuiFolder::dispatchInternalEvent);
 		children.push_back(item);
+		mLayoutDirty = true;
+		adoptChild(item);
+		// a sub folder added mid batch joins the batch it was added in
+		if (auto * f = dynamic_cast<ofxDatGuiFolder *>(item)) {
+			for (int i = 0; i < mBatchDepth; i++) f->beginBatch();
+		}
+		if (mBatchDepth == 0) relayout();
+	}
+
+	// Defer layout while adding many items, the folder is laid out once in endBatch().
+	// Sub folders batch along with it.
+	void beginBatch() {
+		mBatchDepth++;
+		for (auto c : children) {
+			if (auto * f = dynamic_cast<ofxDatGuiFolder *>(c)) f->beginBatch();
+		}
+	}
+	void endBatch() {
+		if (mBatchDepth == 0) return;
+		// sub folders close first so their relayout lands while this folder still defers
+		for (auto c : children) {
+			if (auto * f = dynamic_cast<ofxDatGuiFolder *>(c)) f->endBatch();
+		}
+		if (--mBatchDepth > 0) return;
+		if (mLayoutDirty) relayout();
 	}
 
 	ofxDatGuiComponent * getComponent(ofxDatGuiType type, string label) {
+		// a folder in a gui is indexed, one that isn't attached yet is scanned
+		if (getLookupIndex() != nullptr) return getLookupIndex()->findChild(this, type, label);
+		// fold once instead of once per child
+		const string key = ofxDatGuiComponent::foldName(label);
 		for (int i = 0; i < (int)children.size(); i++) {
-			if (children[i]->getType() == type && children[i]->is(label)) return children[i];
+			if (children[i]->getType() == type && children[i]->getNameKey() == key) return children[i];
 		}
 		return NULL;
 	}
@@ -492,9 +514,16 @@ public:
 	static ofxDatGuiFolder * getInstance() { return new ofxDatGuiFolder("X"); }
 
 private:
-	DropdownCB dropdownEventCallback;
+	// items added later come from the pool this folder was created from
+	std::shared_ptr<ofxDatGuiPool> mAllocator = ofxDatGuiPool::current();
+
+	// An expanded folder changes height as items are added, let the parent know.
+	void relayout() {
+		if (!mIsExpanded) return;
+		layout();
+		onGroupToggled();
+	}
 
-	RadioGroupCB radioGroupEventCallback;
 	std::vector<std::shared_ptr<ofxDatGuiColorPicker>> pickers;
 
 	bool fHeaderPressed = false;
@@ -46,11 +46,7 @@ class ofxDatGuiBreak : public ofxDatGuiComponent{
         void draw()
         {
             if (!mVisible) return;
-            ofPushStyle();
-                ofFill();
-                ofSetColor(mStyle.color.background, mStyle.opacity);
-                ofDrawRectangle(x, y, mStyle.width, mStyle.height);
-            ofPopStyle();
+            drawBackground();
         }
     
         int getHeight()
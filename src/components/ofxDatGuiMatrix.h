@@ -45,15 +45,10 @@ class ofxDatGuiMatrixButton : public ofxDatGuiInteractiveObject {
         {
             mRect.x = x + origin.x;
             mRect.y = y + origin.y;
-            ofPushStyle();
-                ofFill();
-                ofSetColor(mBkgdColor);
-                ofDrawRectangle(mRect);
-                if (mShowLabels) {
-                    ofSetColor(mLabelColor);
-                    mFont->draw(ofToString(mIndex+1), mRect.x + mRect.width/2 - mFontRect.width/2, mRect.y + mRect.height/2 + mFontRect.height/2);
-                }
-            ofPopStyle();
+            ofxDatGuiRenderer::rect(mRect, mBkgdColor);
+            if (mShowLabels) {
+                ofxDatGuiRenderer::text(mFont, ofToString(mIndex+1), mRect.x + mRect.width/2 - mFontRect.width/2, mRect.y + mRect.height/2 + mFontRect.height/2, mLabelColor);
+            }
         }
     
         void hitTest(ofPoint m, bool mouseDown)
@@ -216,21 +211,22 @@ class ofxDatGuiMatrix : public ofxDatGuiComponent {
         void draw()
         {
             if (!mVisible) return;
-            ofPushStyle();
+            ofxDatGuiRenderState::push();
                 ofxDatGuiComponent::draw();
-                ofSetColor(mFillColor);
-                ofDrawRectangle(mMatrixRect);
+                ofxDatGuiRenderer::rect(mMatrixRect, mFillColor);
                 for(int i=0; i<btns.size(); i++) btns[i].draw(x+mLabel.width, y);
-            ofPopStyle();
+            ofxDatGuiRenderState::pop();
         }
     
         void clear()
         {
             for (int i=0; i<btns.size(); i++) btns[i].setSelected(false);
+            markDirty();
         }
     
         void setSelected(vector<int> v)
         {
+            if (mInert) return;
             clear();
             for (int i=0; i<v.size(); i++) btns[v[i]].setSelected(true);
             mLastItemSelected = &btns[v.back()];
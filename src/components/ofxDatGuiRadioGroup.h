@@ -56,16 +56,19 @@ public:
 	void hideHeader(bool hide = true) { setHeaderVisible(!hide); }
 
 	ofxDatGuiToggle * addOption(const std::string & label) {
+		ofxDatGuiPool::Scope alloc(mAllocator);
 		auto * t = new ofxDatGuiToggle(label, false);
 		t->setStripeVisible(false);
 		t->onToggleEvent(this, &ofxDatGuiRadioGroup::onOptionToggled);
 		children.push_back(t);
 		mOptions.push_back(t);
+		adoptChild(t);
 		layoutChildren();
 		return t;
 	}
 
 	void setSelectedIndex(int index) {
+		if (mInert) return;
 		if (index < 0 || index >= (int)mOptions.size()) return;
 		if (mSelected == index) {
 			mOptions[index]->setChecked(true);
@@ -142,19 +145,14 @@ public:
 			opt->draw();
 	}
 
-	// Event hookup
-	template <typename T>
-	void onRadioGroupEvent(T * listener, void (T::*handler)(ofxDatGuiRadioGroupEvent)) {
-		mEventCallback = std::bind(handler, listener, std::placeholders::_1);
-	}
-
 private:
 	Orientation mOrientation;
 	int mHeaderHeightCache = -1;
 	std::vector<ofxDatGuiToggle *> mOptions;
 	int mSelected;
 	bool mHeaderVisible;
-	std::function<void(ofxDatGuiRadioGroupEvent)> mEventCallback;
+	// options added later come from the pool this group was created from
+	std::shared_ptr<ofxDatGuiPool> mAllocator = ofxDatGuiPool::current();
 
 	    void layoutChildren() {
 		if (mOptions.empty()) return;
@@ -220,8 +218,12 @@ private:
 	}
 
 	void dispatch() {
-		if (!mEventCallback) return;
+		if (!radioGroupEventCallback) {
+			// forwarded to a folder or gui that has no listener //
+			if (radioGroupEventCallback.forwarding()) ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
+			return;
+		}
 		ofxDatGuiRadioGroupEvent evt(this, mSelected, getSelectedLabel());
-		mEventCallback(evt);
+		radioGroupEventCallback(evt);
 	}
 };
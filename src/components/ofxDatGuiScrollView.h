@@ -54,13 +54,12 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
             mAutoHeight = true;
             mNumVisible = nVisible;
             setTheme(ofxDatGuiComponent::getTheme());
-            ofAddListener(ofEvents().mouseScrolled, this, &ofxDatGuiScrollView::onMouseScrolled, OF_EVENT_ORDER_BEFORE_APP);
+            ofxDatGuiInput::setScrollTarget(this, true);
         }
     
         ~ofxDatGuiScrollView()
         {
             mTheme = nullptr;
-            ofRemoveListener(ofEvents().mouseScrolled, this, &ofxDatGuiScrollView::onMouseScrolled, OF_EVENT_ORDER_BEFORE_APP);
         }
     
     /*
@@ -238,22 +237,26 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
     
         void draw()
         {
-            ofPushStyle();
-                ofFill();
+        // batch the list content only if whatever draws the scroll view is batching //
+            bool batch = ofxDatGuiRenderer::isBatching();
+            ofxDatGuiRenderer::sync();
+            ofxDatGuiRenderState::push();
+                ofxDatGuiRenderState::fill();
             // draw a background behind the fbo //
-                ofSetColor(ofColor::black);
+                ofxDatGuiRenderState::setColor(ofColor::black);
                 ofDrawRectangle(mRect);
-            // draw into the fbo //
+            // draw into the fbo, a batching gui gets the items in a single draw call //
                 mView.begin();
                 ofClear(255,255,255,0);
-                ofSetColor(mBackground);
-                ofDrawRectangle(0, 0, mRect.width, mRect.height);
+                if (batch) mRenderer.begin();
+                ofxDatGuiRenderer::rect(0, 0, mRect.width, mRect.height, mBackground);
                 for(auto i:mItems) i->draw();
+                if (batch) mRenderer.end();
                 mView.end();
             // draw the fbo of list content //
-                ofSetColor(ofColor::white);
+                ofxDatGuiRenderState::setColor(ofColor::white);
                 mView.draw(mRect.x, mRect.y);
-            ofPopStyle();
+            ofxDatGuiRenderState::pop();
         }
     
         void dispatchEvent()
@@ -269,6 +272,7 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
     private:
     
         ofFbo mView;
+        ofxDatGuiRenderer mRenderer;
         ofRectangle mRect;
         ofColor mBackground;
         const ofxDatGuiTheme* mTheme;
@@ -286,32 +290,32 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
             if (mRect.width > 0 && mRect.height > 0) mView.allocate( mRect.width, mRect.height );
         }
     
-        void onMouseScrolled(ofMouseEventArgs &e)
-        {
-            if (mItems.size() > 0 && mRect.inside(e.x, e.y) == true){
-                float sy = e.scrollY * 2;
-                int btnH = mItems.front()->getHeight() + mSpacing;
-                int minY = mRect.height + mSpacing  - (mItems.size() * btnH);
-                bool allowScroll = false;
-                mY = mItems.front()->getY();
-                if (sy < 0){
-                    if (mY > minY){
-                        mY += sy;
-                        if (mY < minY) mY = minY;
-                        allowScroll = true;
-                    }
-                }   else if (sy > 0){
-                    if (mY < 0){
-                        mY += sy;
-                        if (mY > 0) mY = 0;
-                        allowScroll = true;
-                    }
+        bool onMouseScrolled(ofMouseEventArgs &e)
+        {
+            if (mItems.size() == 0 || mRect.inside(e.x, e.y) == false) return false;
+            float sy = e.scrollY * 2;
+            int btnH = mItems.front()->getHeight() + mSpacing;
+            int minY = mRect.height + mSpacing  - (mItems.size() * btnH);
+            bool allowScroll = false;
+            mY = mItems.front()->getY();
+            if (sy < 0){
+                if (mY > minY){
+                    mY += sy;
+                    if (mY < minY) mY = minY;
+                    allowScroll = true;
                 }
-                if (allowScroll){
-                    mItems.front()->setPosition(0, mY);
-                    for(int i=0; i<mItems.size(); i++) mItems[i]->setPosition(0, mY + (btnH * i));
+            }   else if (sy > 0){
+                if (mY < 0){
+                    mY += sy;
+                    if (mY > 0) mY = 0;
+                    allowScroll = true;
                 }
             }
+            if (allowScroll){
+                mItems.front()->setPosition(0, mY);
+                for(int i=0; i<mItems.size(); i++) mItems[i]->setPosition(0, mY + (btnH * i));
+            }
+            return true;
         }
     
         void onButtonEvent(ofxDatGuiButtonEvent e)
@@ -332,6 +336,8 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
                 mItems[i]->setPosition(0, y);
                 y = mItems[i]->getY() + mItems[i]->getHeight() + mSpacing;
             }
+        // items moved under the mouse, resolve hover again next frame //
+            ofxDatGuiInput::invalidate();
         }
     
         bool isValidIndex(int index)
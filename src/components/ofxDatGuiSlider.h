@@ -23,6 +23,8 @@
 #pragma once
 #include "ofxDatGuiComponent.h"
 #include "ofxDatGuiTextInputField.h"
+#include "ofxDatGuiTripleBuffer.h"
+#include "ofxDatGuiSliderCore.h"
 
 class ofxDatGuiSlider : public ofxDatGuiComponent {
 
@@ -34,9 +36,8 @@ class ofxDatGuiSlider : public ofxDatGuiComponent {
             mMax = max;
             setPrecision(2);
             mType = ofxDatGuiType::SLIDER;
-            mInput = new ofxDatGuiTextInputField();
-            mInput->setTextInputFieldType(ofxDatGuiInputType::NUMERIC);
-            mInput->onInternalEvent(this, &ofxDatGuiSlider::onInputChanged);
+            mInput.setTextInputFieldType(ofxDatGuiInputType::NUMERIC);
+            mInput.onInternalEvent(this, &ofxDatGuiSlider::onInputChanged);
             setTheme(ofxDatGuiComponent::getTheme());
             setValue(val, false); // don't dispatch a change event when component is constructed //
         }
@@ -55,19 +56,14 @@ class ofxDatGuiSlider : public ofxDatGuiComponent {
             mParamF->addListener(this, &ofxDatGuiSlider::onParamF);
         }
     
-        ~ofxDatGuiSlider()
-        {
-            delete mInput;
-        }
-    
         void setTheme(const ofxDatGuiTheme* theme)
         {
             setComponentStyle(theme);
             mSliderFill = theme->color.slider.fill;
             mBackgroundFill = theme->color.inputAreaBackground;
             mStyle.stripe.color = theme->stripe.slider;
-            mInput->setTheme(theme);
-            mInput->setTextInactiveColor(theme->color.slider.text);
+            mInput.setTheme(theme);
+            mInput.setTextInactiveColor(theme->color.slider.text);
             setWidth(theme->layout.width, theme->layout.labelWidth);
         }
     
@@ -78,24 +74,25 @@ class ofxDatGuiSlider : public ofxDatGuiComponent {
             mSliderWidth = totalWidth * .7;
             mInputX = mLabel.width + mSliderWidth + mStyle.padding;
             mInputWidth = totalWidth - mSliderWidth - (mStyle.padding * 2);
-            mInput->setWidth(mInputWidth);
-            mInput->setPosition(x + mInputX, y + mStyle.padding);
+            mInput.setWidth(mInputWidth);
+            mInput.setPosition(x + mInputX, y + mStyle.padding);
         }
     
         void setPosition(int x, int y)
         {
             ofxDatGuiComponent::setPosition(x, y);
-            mInput->setPosition(x + mInputX, y + mStyle.padding);
+            mInput.setPosition(x + mInputX, y + mStyle.padding);
         }
     
-        void setPrecision(int precision)
+        virtual void setPrecision(int precision)
         {
             mPrecision = precision;
             if (mPrecision > MAX_PRECISION) mPrecision = MAX_PRECISION;
         }
     
-        void setMin(float min)
+        virtual void setMin(float min)
         {
+            if (mInert) return;
             mMin = min;
             if (mMin < mMax){
                 calculateScale();
@@ -104,8 +101,9 @@ class ofxDatGuiSlider : public ofxDatGuiComponent {
             }
         }
     
-        void setMax(float max)
+        virtual void setMax(float max)
         {
+            if (mInert) return;
             mMax = max;
             if (mMax > mMin){
                 calculateScale();
@@ -114,8 +112,9 @@ class ofxDatGuiSlider : public ofxDatGuiComponent {
             }
         }
     
-        void setValue(float value, bool dispatchEvent = true)
+        virtual void setValue(float value, bool dispatchEvent = true)
         {
+            if (mInert) return;
             value = round(value, mPrecision);
             if (value != mValue){
                 mValue = value;
@@ -125,6 +124,7 @@ class ofxDatGuiSlider : public ofxDatGuiComponent {
                     mValue = mMin;
                 }
                 calculateScale();
+                markDirty();
                 if (dispatchEvent) dispatchSliderChangedEvent();
             }
         }
@@ -134,14 +134,16 @@ class ofxDatGuiSlider : public ofxDatGuiComponent {
             return mValue;
         }
     
-        void setScale(float scale)
+        virtual void setScale(float scale)
         {
+            if (mInert) return;
             mScale = scale;
             if (mScale < 0 || mScale > 1){
                 ofLogError() << "row #" << mIndex << " : scale must be between 0 & 1" << " [setting to 50%]";
                 mScale = 0.5f;
             }
             mValue = ((mMax-mMin) * mScale) + mMin;
+            markDirty();
         }
     
         float getScale()
@@ -155,59 +157,129 @@ class ofxDatGuiSlider : public ofxDatGuiComponent {
     
         void bind(int &val)
         {
+            if (mInert) return;
+            unbind();
             mBoundi = &val;
-            mBoundf = nullptr;
         }
     
         void bind(float &val)
         {
+            if (mInert) return;
+            unbind();
             mBoundf = &val;
-            mBoundi = nullptr;
         }
 
         void bind(int &val, int min, int max)
         {
+            if (mInert) return;
             mMin = min;
             mMax = max;
-            mBoundi = &val;
-            mBoundf = nullptr;
+            bind(val);
         }
     
         void bind(float &val, float min, float max)
         {
+            if (mInert) return;
             mMin = min;
             mMax = max;
-            mBoundf = &val;
+            bind(val);
+        }
+    
+    /*
+        atomics can be read and written from audio and worker threads while the slider updates them.
+        a value the thread stored is shown as is, a change made in the gui is only published if the
+        thread hasn't stored something newer since, in which case the thread's value wins
+    */
+        void bind(std::atomic<int> &val)
+        {
+            if (mInert) return;
+            unbind();
+            mBoundAi = &val;
+        }
+    
+        void bind(std::atomic<float> &val)
+        {
+            if (mInert) return;
+            unbind();
+            mBoundAf = &val;
+        }
+    
+        void bind(std::atomic<int> &val, int min, int max)
+        {
+            if (mInert) return;
+            mMin = min;
+            mMax = max;
+            bind(val);
+        }
+    
+        void bind(std::atomic<float> &val, float min, float max)
+        {
+            if (mInert) return;
+            mMin = min;
+            mMax = max;
+            bind(val);
+        }
+    
+    // bind to a member of a triple buffered struct, every change is published to its consumer.
+    // this is one way only, values the consumer wants the gui to show have to go through an atomic //
+        template<typename T>
+        void bind(ofxDatGuiTripleBuffer<T> &buffer, int T::*member)
+        {
+            if (mInert) return;
+            bind(buffer.edit().*member);
+            mPublisher = &buffer;
+        }
+    
+        template<typename T>
+        void bind(ofxDatGuiTripleBuffer<T> &buffer, float T::*member)
+        {
+            if (mInert) return;
+            bind(buffer.edit().*member);
+            mPublisher = &buffer;
+        }
+    
+        virtual void unbind()
+        {
             mBoundi = nullptr;
+            mBoundf = nullptr;
+            mBoundAi = nullptr;
+            mBoundAf = nullptr;
+            mPublisher = nullptr;
+            mBoundSeen = false;
         }
     
         void update(bool acceptEvents = true)
         {
             ofxDatGuiComponent::update(acceptEvents);
-        // check for variable bindings //
-            if (mBoundf != nullptr && !mInput->hasFocus()) {
-                setValue(*mBoundf);
-            }   else if (mBoundi != nullptr && !mInput->hasFocus()){
-                setValue(*mBoundi);
+        // check for variable bindings, only a value that moved since the last frame is applied //
+            if (mInput.hasFocus()) return;
+            if (mBoundf != nullptr) {
+                syncBound(*mBoundf);
+            }   else if (mBoundi != nullptr){
+                syncBound(*mBoundi);
+            }   else if (mBoundAf != nullptr){
+            // pairs with the thread's release store, whatever it wrote before the value is visible too //
+                syncBound(mBoundAf->load(std::memory_order_acquire));
+            }   else if (mBoundAi != nullptr){
+                syncBound(mBoundAi->load(std::memory_order_acquire));
             }
         }
 
         void draw()
         {
             if (!mVisible) return;
-            ofPushStyle();
+            ofxDatGuiRenderState::push();
                 ofxDatGuiComponent::draw();
             // slider bkgd //
-                ofSetColor(mBackgroundFill);
-                ofDrawRectangle(x+mLabel.width, y+mStyle.padding, mSliderWidth, mStyle.height-(mStyle.padding*2));
+                ofxDatGuiRenderer::rect(x+mLabel.width, y+mStyle.padding, mSliderWidth, mStyle.height-(mStyle.padding*2), mBackgroundFill);
             // slider fill //
                 if (mScale > 0){
-                    ofSetColor(mSliderFill);
-                    ofDrawRectangle(x+mLabel.width, y+mStyle.padding, mSliderWidth*mScale, mStyle.height-(mStyle.padding*2));
+                    ofxDatGuiRenderer::rect(x+mLabel.width, y+mStyle.padding, mSliderWidth*mScale, mStyle.height-(mStyle.padding*2), mSliderFill);
                 }
-            // numeric input field //
-                mInput->draw();
-            ofPopStyle();
+            // numeric input field, its text is only formatted when the value changed //
+                syncTextInput();
+                mInput.draw();
+            ofxDatGuiRenderState::pop();
         }
     
         bool hitTest(ofPoint m)
@@ -216,7 +288,7 @@ class ofxDatGuiSlider : public ofxDatGuiComponent {
                 return false;
             }   else if (m.x>=x+mLabel.width && m.x<= x+mLabel.width+mSliderWidth && m.y>=y+mStyle.padding && m.y<= y+mStyle.height-mStyle.padding){
                 return true;
-            }   else if (mInput->hitTest(m)){
+            }   else if (mInput.hitTest(m)){
                 return true;
             }   else{
                 return false;
@@ -240,65 +312,93 @@ class ofxDatGuiSlider : public ofxDatGuiComponent {
         void onMousePress(ofPoint m)
         {
             ofxDatGuiComponent::onMousePress(m);
-            if (mInput->hitTest(m)){
-                mInput->onFocus();
-            }   else if (mInput->hasFocus()){
-                mInput->onFocusLost();
+            if (mInput.hitTest(m)){
+                syncTextInput();
+                mInput.onFocus();
+            }   else if (mInput.hasFocus()){
+                mInput.onFocusLost();
             }
         }
     
         void onMouseDrag(ofPoint m)
         {
-            if (mFocused && mInput->hasFocus() == false){
+            if (mFocused && mInput.hasFocus() == false){
                 float s = (m.x-x-mLabel.width)/mSliderWidth;
                 if (s > .999) s = 1;
                 if (s < .001) s = 0;
         // don't dispatch an event if scale hasn't changed //
                 if (s == mScale) return;
-                mScale = s;
-                setValue(((mMax-mMin) * mScale) + mMin);
+                setFromScale(s);
             }
         }
     
         void onMouseRelease(ofPoint m)
         {
             ofxDatGuiComponent::onMouseRelease(m);
-            if (mInput->hitTest(m) == false) onFocusLost();
+            if (mInput.hitTest(m) == false) onFocusLost();
         }
     
         void onFocusLost()
         {
             ofxDatGuiComponent::onFocusLost();
-            if (mInput->hasFocus()) mInput->onFocusLost();
+            if (mInput.hasFocus()) mInput.onFocusLost();
         }
     
         void onKeyPressed(int key)
         {
-            if (mInput->hasFocus()) mInput->onKeyPressed(key);
+            if (mInput.hasFocus()) mInput.onKeyPressed(key);
         }
     
         void onInputChanged(ofxDatGuiInternalEvent e)
         {
-            setValue(ofToFloat(mInput->getText()));
+            setFromText(mInput.getText());
+        }
+    
+    // the value type specific parts, see ofxDatGuiSliderT //
+        virtual void setFromScale(float s)
+        {
+            mScale = s;
+            setValue(((mMax-mMin) * mScale) + mMin);
+        }
+    
+        virtual void setFromText(const string& text)
+        {
+            setValue(ofToFloat(text));
         }
     
         void dispatchSliderChangedEvent()
         {
-        // update any bound variables //
-            if (mBoundf != nullptr) {
-                *mBoundf = mValue;
-            }   else if (mBoundi != nullptr) {
-                *mBoundi = mValue;
-            }   else if (mParamI != nullptr) {
-                mParamI->set(mValue);
-            }   else if (mParamF != nullptr) {
-                mParamF->set(mValue);
+        // update any bound variables, unless the change came from them in the first place //
+            if (mSyncing == false){
+                if (mBoundf != nullptr) {
+                    *mBoundf = mValue;
+                    mBoundLast = *mBoundf;
+                }   else if (mBoundi != nullptr) {
+                    *mBoundi = mValue;
+                    mBoundLast = *mBoundi;
+                }   else if (mBoundAf != nullptr) {
+                    float seen = mBoundLast;
+                    if (mBoundAf->compare_exchange_strong(seen, mValue, std::memory_order_acq_rel, std::memory_order_acquire)) mBoundLast = mValue;
+                }   else if (mBoundAi != nullptr) {
+                    int seen = mBoundLast;
+                    if (mBoundAi->compare_exchange_strong(seen, (int)mValue, std::memory_order_acq_rel, std::memory_order_acquire)) mBoundLast = (int)mValue;
+                }   else if (mParamI != nullptr) {
+                    mParamI->set(mValue);
+                }   else if (mParamF != nullptr) {
+                    mParamF->set(mValue);
+                }
             }
+            if (mPublisher != nullptr) mPublisher->publish();
         // dispatch event out to main application //
+            emitEvent();
+        }
+    
+        void deliverEvent()
+        {
             dispatchEvent();
         }
 
-    private:
+    protected:
     
         float   mMin;
         float   mMax;
@@ -310,24 +410,49 @@ class ofxDatGuiSlider : public ofxDatGuiComponent {
         int     mSliderWidth;
         ofColor mSliderFill;
         ofColor mBackgroundFill;
-        ofxDatGuiTextInputField* mInput;
+        ofxDatGuiTextInputField mInput;
+        bool    mTextDirty = true;
     
         static const int MAX_PRECISION = 4;
     
         int*    mBoundi = nullptr;
         float*  mBoundf = nullptr;
+        std::atomic<int>*   mBoundAi = nullptr;
+        std::atomic<float>* mBoundAf = nullptr;
+        ofxDatGuiPublisher* mPublisher = nullptr;
+        float   mBoundLast = 0;
+        bool    mBoundSeen = false;
+        bool    mSyncing = false;
         ofParameter<int>* mParamI = nullptr;
         ofParameter<float>* mParamF = nullptr;
         void onParamI(int& n) { setValue(n); }
         void onParamF(float& n) { setValue(n); }
     
+        void syncBound(float value)
+        {
+            if (mBoundSeen && value == mBoundLast) return;
+            mBoundSeen = true;
+            mBoundLast = value;
+            mSyncing = true;
+            setValue(value);
+            mSyncing = false;
+        }
+    
         void calculateScale()
         {
             mScale = ofxDatGuiScale(mValue, mMin, mMax);
+        // formatting and measuring the text waits until the slider is drawn //
+            mTextDirty = true;
+        }
+    
+        void syncTextInput()
+        {
+            if (!mTextDirty) return;
+            mTextDirty = false;
             setTextInput();
         }
     
-        void setTextInput()
+        virtual void setTextInput()
         {
             string v = ofToString(round(mValue, mPrecision));
             if (mValue != mMin && mValue != mMax){
@@ -338,12 +463,13 @@ class ofxDatGuiSlider : public ofxDatGuiComponent {
                 }
                 while(v.length() - p < (mPrecision + 1)) v+='0';
             }
-            mInput->setText(v);
+            mInput.setText(v);
         }
     
         float round(float num, int precision)
         {
-            return roundf(num * pow(10, precision)) / pow(10, precision);
+            const double p = ofxDatGuiSliderCore<float>::pow10(precision);
+            return roundf(num * p) / p;
         }
     
         void onInvalidMinMaxValues()
@@ -357,3 +483,223 @@ class ofxDatGuiSlider : public ofxDatGuiComponent {
         
 };
 
+/*
+    a slider that keeps its value, range and precision as T (int, int64_t, float or double).
+    integer sliders never round and never pass through float, large ranges like frame counters
+    or sample offsets stay exact. events and getValue() still carry a float, get() is exact.
+*/
+
+template<typename T>
+class ofxDatGuiSliderT : public ofxDatGuiSlider {
+
+    public:
+    
+        ofxDatGuiSliderT(string label, T min, T max, T val) : ofxDatGuiSlider(label, min, max, val), mCore(min, max, val)
+        {
+            mirror();
+        }
+    
+        ofxDatGuiSliderT(string label, T min, T max) : ofxDatGuiSliderT(label, min, max, min + max/2 - min/2) {}
+    
+        ofxDatGuiSliderT(ofParameter<T> & p) : ofxDatGuiSliderT(p.getName(), p.getMin(), p.getMax(), p.get())
+        {
+            mParamT = &p;
+            mParamT->addListener(this, &ofxDatGuiSliderT::onParamT);
+        }
+    
+        ~ofxDatGuiSliderT()
+        {
+            if (mParamT != nullptr) mParamT->removeListener(this, &ofxDatGuiSliderT::onParamT);
+        }
+    
+        void set(T value, bool dispatchEvent = true)
+        {
+            if (mCore.set(value)){
+                mirror();
+                markDirty();
+                if (dispatchEvent) dispatchSliderChangedEvent();
+            }
+        }
+    
+        T get() const
+        {
+            return mCore.get();
+        }
+    
+        T getMin() const
+        {
+            return mCore.getMin();
+        }
+    
+        T getMax() const
+        {
+            return mCore.getMax();
+        }
+    
+        void setRange(T min, T max)
+        {
+            if (mInert) return;
+            if (!mCore.setRange(min, max)){
+                ofLogError() << "row #" << mIndex << " : invalid min & max values" << " [range unchanged]";
+            }
+            mirror();
+            markDirty();
+        }
+    
+        void setValue(float value, bool dispatchEvent = true)
+        {
+            set(mCore.cast(value), dispatchEvent);
+        }
+    
+        void setMin(float min)
+        {
+            setRange(mCore.cast(min), mCore.getMax());
+        }
+    
+        void setMax(float max)
+        {
+            setRange(mCore.getMin(), mCore.cast(max));
+        }
+    
+        void setPrecision(int precision)
+        {
+            mCore.setPrecision(precision);
+            mirror();
+        }
+    
+        void setScale(float scale)
+        {
+            if (scale < 0 || scale > 1){
+                ofLogError() << "row #" << mIndex << " : scale must be between 0 & 1" << " [setting to 50%]";
+                scale = 0.5f;
+            }
+            mCore.set(mCore.fromScale(scale));
+            mirror();
+            markDirty();
+        }
+    
+    /*
+        variable binding methods, a variable of type T is read and written without conversions
+    */
+    
+        using ofxDatGuiSlider::bind;
+    
+        void bind(T &val)
+        {
+            if (mInert) return;
+            unbind();
+            mBoundT = &val;
+        }
+    
+        void bind(T &val, T min, T max)
+        {
+            if (mInert) return;
+            setRange(min, max);
+            bind(val);
+        }
+    
+        void bind(std::atomic<T> &val)
+        {
+            if (mInert) return;
+            unbind();
+            mBoundAT = &val;
+        }
+    
+        void bind(std::atomic<T> &val, T min, T max)
+        {
+            if (mInert) return;
+            setRange(min, max);
+            bind(val);
+        }
+    
+        void unbind()
+        {
+            ofxDatGuiSlider::unbind();
+            mBoundT = nullptr;
+            mBoundAT = nullptr;
+            mBoundTSeen = false;
+        }
+    
+        void update(bool acceptEvents = true)
+        {
+            ofxDatGuiSlider::update(acceptEvents);
+            if (mInput.hasFocus()) return;
+            if (mBoundT != nullptr){
+                syncBoundT(*mBoundT);
+            }   else if (mBoundAT != nullptr){
+                syncBoundT(mBoundAT->load(std::memory_order_acquire));
+            }
+        }
+    
+    protected:
+    
+        void setFromScale(float s)
+        {
+            set(mCore.fromScale(s));
+        }
+    
+        void setFromText(const string& text)
+        {
+            T value;
+            if (ofxDatGuiSliderCore<T>::parse(text, value)){
+                set(value);
+            }
+        // put back what the value actually is, text that wasn't a number or was clamped //
+            mTextDirty = true;
+        }
+    
+        void setTextInput()
+        {
+            mInput.setText(mCore.format());
+        }
+    
+        void dispatchSliderChangedEvent()
+        {
+            if (mSyncing == false){
+                if (mBoundT != nullptr){
+                    *mBoundT = mCore.get();
+                    mBoundTLast = mCore.get();
+                }   else if (mBoundAT != nullptr){
+                // a failed exchange means the thread stored a newer value, the next update() shows it //
+                    T seen = mBoundTLast;
+                    if (mBoundAT->compare_exchange_strong(seen, mCore.get(), std::memory_order_acq_rel, std::memory_order_acquire)) mBoundTLast = mCore.get();
+                }   else if (mParamT != nullptr){
+                    mParamT->set(mCore.get());
+                }
+            }
+            ofxDatGuiSlider::dispatchSliderChangedEvent();
+        }
+    
+    private:
+    
+        ofxDatGuiSliderCore<T> mCore;
+        T*  mBoundT = nullptr;
+        std::atomic<T>* mBoundAT = nullptr;
+        T   mBoundTLast = T();
+        bool mBoundTSeen = false;
+        ofParameter<T>* mParamT = nullptr;
+    
+        void onParamT(T& value) { set(value); }
+    
+        void syncBoundT(T value)
+        {
+            if (mBoundTSeen && value == mBoundTLast) return;
+            mBoundTSeen = true;
+            mBoundTLast = value;
+            mSyncing = true;
+            set(value);
+            mSyncing = false;
+        }
+    
+    // keep the float state the base slider draws and hit tests with in step with the core //
+        void mirror()
+        {
+            mValue = (float)mCore.get();
+            mMin = (float)mCore.getMin();
+            mMax = (float)mCore.getMax();
+            mScale = (float)mCore.getScale();
+            mPrecision = mCore.getPrecision();
+            mTextDirty = true;
+        }
+
+};
@@ -0,0 +1,136 @@
+/*
+    Copyright (C) 2015 Stephen Braitsch [http://braitsch.io]
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+#include "ofxDatGuiComponent.h"
+
+/*
+    shows the per frame update & draw cost of a gui (in milliseconds, averaged
+    over the refresh interval) followed by the component types that cost the most.
+    numbers are only collected when the addon is built with OFX_DATGUI_PROFILE.
+*/
+
+class ofxDatGuiStatsMonitor : public ofxDatGuiComponent {
+
+    public:
+
+        ofxDatGuiStatsMonitor(const ofxDatGuiStats* stats, float refresh = 1.0f, int rows = 4) : ofxDatGuiComponent("gui ms")
+        {
+            mStats = stats;
+            mRefresh = refresh;
+            mRows = max(0, rows);
+            mTime = ofGetElapsedTimef();
+            mType = ofxDatGuiType::STATS_MONITOR;
+            setTheme(ofxDatGuiComponent::getTheme());
+            sample();
+        }
+
+        void setTheme(const ofxDatGuiTheme* theme)
+        {
+            setComponentStyle(theme);
+            mStyle.stripe.color = theme->stripe.graph;
+            setWidth(theme->layout.width, theme->layout.labelWidth);
+        }
+
+        int getHeight()
+        {
+            return mStyle.height * (mRows + 1);
+        }
+
+        void update(bool acceptEvents = true)
+        {
+            if (ofGetElapsedTimef() - mTime > mRefresh){
+                mTime = ofGetElapsedTimef();
+                sample();
+                markDirty();
+            }
+        }
+
+        void draw()
+        {
+            if (mVisible == false) return;
+            ofxDatGuiComponent::draw();
+            ofColor bkgd(mStyle.color.background, mStyle.opacity);
+            int baseline = mStyle.height/2 + mLabel.rect.height/2;
+            ofxDatGuiRenderer::text(mFont, mSummary, x + mLabel.width, y + baseline, mLabel.color);
+            for (int i=0; i<mRows; i++){
+                int ry = y + mStyle.height * (i+1);
+                ofxDatGuiRenderer::rect(x, ry, mStyle.width, mStyle.height, bkgd);
+                if (i >= mLines.size()) continue;
+                ofxDatGuiRenderer::text(mFont, mLines[i].first, x + mLabel.x, ry + baseline, mLabel.color);
+                ofxDatGuiRenderer::text(mFont, mLines[i].second, x + mLabel.width, ry + baseline, mLabel.color);
+            }
+            if (mStyle.stripe.visible) ofxDatGuiRenderer::rect(x, y, mStyle.stripe.width, getHeight(), mStyle.stripe.color);
+        }
+
+    private:
+
+        static string ms(double us, uint64_t frames)
+        {
+            return ofToString(us / frames / 1000.0, 3);
+        }
+
+        void remember()
+        {
+        // the per instance table can be large and isn't shown here //
+            mLast.frames = mStats->frames;
+            mLast.gui = mStats->gui;
+            mLast.types = mStats->types;
+        }
+
+        void sample()
+        {
+            mLines.clear();
+            uint64_t frames = mStats->frames - mLast.frames;
+            if (frames == 0 || mStats->frames < mLast.frames){
+        // nothing new, or the stats were reset since the last refresh //
+                mSummary = mStats->frames == 0 ? "n/a" : mSummary;
+                remember();
+                return;
+            }
+            double u = mStats->gui.update.total - mLast.gui.update.total;
+            double d = mStats->gui.draw.total - mLast.gui.draw.total;
+            mSummary = "U " + ms(u, frames) + "  D " + ms(d, frames);
+        // rank the component types by what they cost over this interval //
+            vector<pair<double, ofxDatGuiType>> cost;
+            for (auto & t : mStats->types){
+                double was = 0;
+                auto last = mLast.types.find(t.first);
+                if (last != mLast.types.end()) was = last->second.update.total + last->second.draw.total;
+                cost.push_back({t.second.update.total + t.second.draw.total - was, t.first});
+            }
+            std::sort(cost.begin(), cost.end(), [](const pair<double, ofxDatGuiType>& a, const pair<double, ofxDatGuiType>& b){ return a.first > b.first; });
+            for (int i=0; i<cost.size() && i<mRows; i++){
+                mLines.push_back({ofxDatGuiTypeName(cost[i].second), ms(cost[i].first, frames)});
+            }
+            remember();
+        }
+
+        float mTime;
+        float mRefresh;
+        int mRows;
+        string mSummary;
+        vector<pair<string, string>> mLines;
+        const ofxDatGuiStats* mStats;
+        ofxDatGuiStats mLast;
+
+};
@@ -59,7 +59,9 @@ class ofxDatGuiTextInput : public ofxDatGuiComponent {
     
         void setText(string text)
         {
+            if (mInert) return;
             mInput.setText(text);
+            markDirty();
         }
 
         string getText()
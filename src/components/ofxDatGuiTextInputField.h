@@ -67,14 +67,13 @@ class ofxDatGuiTextInputField : public ofxDatGuiInteractiveObject{
         // center the text //
             int tx = mInputRect.x + mInputRect.width / 2 - mTextRect.width / 2;
             int ty = mInputRect.y + mInputRect.height / 2 + mTextRect.height / 2;
-            ofPushStyle();
+            ofxDatGuiRenderState::push();
             // draw the input field background //
                 if (mFocused && mType != ofxDatGuiInputType::COLORPICKER){
-                    ofSetColor(color.active.background);
+                    ofxDatGuiRenderer::rect(mInputRect, color.active.background);
                 }   else {
-                    ofSetColor(color.inactive.background);
+                    ofxDatGuiRenderer::rect(mInputRect, color.inactive.background);
                 }
-                ofDrawRectangle(mInputRect);
             // draw the highlight rectangle //
                 if (mHighlightText){
                     ofRectangle hRect;
@@ -82,18 +81,16 @@ class ofxDatGuiTextInputField : public ofxDatGuiInteractiveObject{
                     hRect.width = mTextRect.width + (mHighlightPadding * 2);
                     hRect.y = ty - mHighlightPadding - mTextRect.height;
                     hRect.height = mTextRect.height + (mHighlightPadding * 2);
-                    ofSetColor(color.highlight);
-                    ofDrawRectangle(hRect);
+                    ofxDatGuiRenderer::rect(hRect, color.highlight);
                 }
             // draw the text //
                 ofColor tColor = mHighlightText ? color.active.text : color.inactive.text;
-                ofSetColor(tColor);
-                mFont->draw(mType == ofxDatGuiInputType::COLORPICKER ? "#" + mRendered : mRendered, tx, ty);
+                ofxDatGuiRenderer::text(mFont, mType == ofxDatGuiInputType::COLORPICKER ? "#" + mRendered : mRendered, tx, ty, tColor);
                 if (mFocused) {
-            // draw the cursor //
-                    ofDrawLine(ofPoint(tx + mCursorX, mInputRect.getTop()), ofPoint(tx + mCursorX, mInputRect.getBottom()));
+            // draw the cursor as a one pixel wide quad so it batches with the rest //
+                    ofxDatGuiRenderer::rect(tx + mCursorX, mInputRect.getTop(), 1, mInputRect.height, tColor);
                 }
-            ofPopStyle();
+            ofxDatGuiRenderState::pop();
         }
     
         int getWidth()
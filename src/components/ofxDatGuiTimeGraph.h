@@ -21,33 +21,21 @@
 */
 
 #pragma once
+#include <cassert>
 #include "ofxDatGuiComponent.h"
+#include "ofxDatGuiWavetable.h"
+#include "ofxDatGuiFifo.h"
+#include "ofxDatGuiMinMax.h"
 
-class ofxDatGuiTimeGraph : public ofxDatGuiComponent {
+/*
+    what every plot shares, the themed plotting area next to the label
+*/
 
-    public:
-    
-        void setDrawMode(ofxDatGuiGraph gMode)
-        {
-            switch (gMode) {
-				case ofxDatGuiGraph::LINES : mDrawFunc = &ofxDatGuiTimeGraph::drawLines;
-                break;
-				case ofxDatGuiGraph::FILLED : mDrawFunc = &ofxDatGuiTimeGraph::drawFilled;
-                break;
-				case ofxDatGuiGraph::POINTS : mDrawFunc = &ofxDatGuiTimeGraph::drawPoints;
-                break;
-				case ofxDatGuiGraph::OUTLINE : mDrawFunc = &ofxDatGuiTimeGraph::drawOutline;
-                break;
-            }
-        }
+class ofxDatGuiPlot : public ofxDatGuiComponent {
 
     protected:
     
-        ofxDatGuiTimeGraph(string label) : ofxDatGuiComponent(label)
-        {
-            mDrawFunc = &ofxDatGuiTimeGraph::drawFilled;
-            setTheme(ofxDatGuiComponent::getTheme());
-        }
+        ofxDatGuiPlot(string label) : ofxDatGuiComponent(label) {}
     
         void setTheme(const ofxDatGuiTheme* theme)
         {
@@ -70,78 +58,270 @@ class ofxDatGuiTimeGraph : public ofxDatGuiComponent {
             mPlotterRect.height = mStyle.height - (mStyle.padding*2);
         }
     
+        int mPointSize;
+        int mLineWeight;
+        struct{
+            ofColor lines;
+            ofColor fills;
+        } mColor;
+        ofRectangle mPlotterRect;
+};
+
+class ofxDatGuiTimeGraph : public ofxDatGuiPlot {
+
+    public:
+    
+        void setDrawMode(ofxDatGuiGraph gMode)
+        {
+            mDrawMode = gMode;
+            mVertsDirty = true;
+            markDirty();
+        }
+
+    protected:
+    
+        ofxDatGuiTimeGraph(string label) : ofxDatGuiPlot(label)
+        {
+            mDrawMode = ofxDatGuiGraph::FILLED;
+            setTheme(ofxDatGuiComponent::getTheme());
+        }
+    
+        void setWidth(int width, float labelWidth)
+        {
+            ofxDatGuiPlot::setWidth(width, labelWidth);
+            mVertsDirty = true;
+        }
+    
         void draw()
         {
             if (!mVisible) return;
-            ofPushStyle();
+            ofxDatGuiRenderState::push();
                 ofxDatGuiComponent::draw();
-                ofSetColor(mStyle.color.inputArea);
-                ofDrawRectangle(x + mPlotterRect.x, y + mPlotterRect.y, mPlotterRect.width, mPlotterRect.height);
-                glColor3ub(mColor.fills.r, mColor.fills.g, mColor.fills.b);
-                (*this.*mDrawFunc)();
-            ofPopStyle();
-        }
-    
-        void drawFilled()
-        {
-            float px = this->x + mPlotterRect.x;
-            float py = this->y + mPlotterRect.y;
-            glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-            glBegin(GL_TRIANGLE_STRIP);
-            for (int i=0; i<pts.size(); i++) {
-                glVertex2f(px+ pts[i].x, py + mPlotterRect.height);
-                glVertex2f(px+ pts[i].x, py + pts[i].y);
+                ofxDatGuiRenderer::rect(x + mPlotterRect.x, y + mPlotterRect.y, mPlotterRect.width, mPlotterRect.height, mStyle.color.inputArea);
+            // the plot is drawn from its own buffer so flush what's been batched so far //
+                ofxDatGuiRenderer::sync();
+                if (mVertsDirty || mPending > 0 || mExtrasDirty) upload();
+                if (mCount > 0){
+                    ofxDatGuiRenderState::setColor(mColor.fills);
+                    ofxDatGuiRenderState::setLineWidth(mLineWeight);
+                // restored by the pop() below //
+                    if (mDrawMode == ofxDatGuiGraph::POINTS) ofxDatGuiRenderState::setPointSize(mLineWeight);
+                    drawSamples();
+                }
+            ofxDatGuiRenderState::pop();
+        }
+    
+    /*
+        the buffer holds one slot per ring sample at x = slot * mSpacing, followed by a copy of
+        slot 0 so the wrapped half of the ring joins up with the rest. a new sample rewrites its
+        own slot only, drawing translates the (up to) two runs of slots into place by the ring
+        offset. the pinned oldest sample and the outline's closing edges don't fit that scheme,
+        they are a handful of vertices after the slots that are rewritten whenever the ring moves
+    */
+    
+        static const int kExtraVerts = 5;
+    
+        void drawSamples()
+        {
+            const int n = mRing.size();
+            const int visible = mCount > 0 && pinned() ? mCount - 1 : mCount;
+            const float left = x + mPlotterRect.x;
+            const float top = y + mPlotterRect.y;
+        // ages 0 .. visible-1 are the slots from the head backwards //
+            const int first = mHead - visible + 1;
+            if (visible > 0){
+                if (first >= 0){
+                    drawSlots(first, mHead, left + mPlotterRect.width - mHead * mSpacing, top);
+                }   else{
+                    drawSlots(first + n, n, left + mPlotterRect.width - (mHead + n) * mSpacing, top);
+                    drawSlots(0, mHead, left + mPlotterRect.width - mHead * mSpacing, top);
+                }
+            }
+            if (mExtraCount > 0){
+                ofPushMatrix();
+                ofTranslate(left, top);
+                mVbo.draw(getPrimitive(), (n + 1) * slotVerts(), mExtraCount);
+                ofPopMatrix();
             }
-            glEnd();
         }
-
-        void drawOutline()
+    
+        void drawSlots(int from, int to, float tx, float ty)
+        {
+            ofPushMatrix();
+            ofTranslate(tx, ty);
+            mVbo.draw(getPrimitive(), from * slotVerts(), (to - from + 1) * slotVerts());
+            ofPopMatrix();
+        }
+    
+        void upload()
+        {
+            const int n = mRing.size();
+            const int vps = slotVerts();
+            const int total = (n + 1) * vps + kExtraVerts;
+            if (mVertsDirty || total > mVboCapacity){
+                mVerts.resize(total);
+                for (int s=0; s<=n; s++) writeSlot(s, &mVerts[s * vps]);
+                mExtraCount = writeExtras(&mVerts[(n + 1) * vps]);
+                if (total > mVboCapacity){
+                    mVboCapacity = total;
+                    mVbo.setVertexData(&mVerts[0], total, GL_STREAM_DRAW);
+                }   else{
+                    mVbo.updateVertexData(&mVerts[0], total);
+                }
+            }   else{
+            // only the slots pushed since the last draw, and slot 0's copy along with it //
+                int pending = min(mPending, n);
+                for (int k=0, i=mHead; k<pending; k++, i = (i == 0 ? n : i) - 1) {
+                    uploadSlot(i);
+                    if (i == 0) uploadSlot(n);
+                }
+                glm::vec2 extras[kExtraVerts];
+                mExtraCount = writeExtras(extras);
+                if (mExtraCount > 0) mVbo.getVertexBuffer().updateData((n + 1) * vps * sizeof(glm::vec2), mExtraCount * sizeof(glm::vec2), extras);
+            }
+            mVertsDirty = false;
+            mExtrasDirty = false;
+            mPending = 0;
+        }
+    
+        void uploadSlot(int slot)
+        {
+            glm::vec2 v[2];
+            writeSlot(slot, v);
+            mVbo.getVertexBuffer().updateData(slot * slotVerts() * sizeof(glm::vec2), slotVerts() * sizeof(glm::vec2), v);
+        }
+    
+        void writeSlot(int slot, glm::vec2* v)
+        {
+            const float sx = slot * mSpacing;
+            const float sy = mRing[slot == mRing.size() ? 0 : slot];
+            if (mDrawMode == ofxDatGuiGraph::FILLED) *v++ = glm::vec2(sx, mPlotterRect.height);
+            *v = glm::vec2(sx, sy);
+        }
+    
+    // plot relative vertices for the pinned oldest sample (joined to the next one) and the outline's closing edges //
+        int writeExtras(glm::vec2* v)
+        {
+            if (mCount == 0) return 0;
+            const float bottom = mPlotterRect.height;
+            const bool pin = pinned();
+            const glm::vec2 oldest(sampleX(mCount - 1), mRing[slotOf(mCount - 1)]);
+            const bool joined = pin && mCount > 1;
+            const glm::vec2 next = joined ? glm::vec2(sampleX(mCount - 2), mRing[slotOf(mCount - 2)]) : oldest;
+            int c = 0;
+            switch (mDrawMode) {
+                case ofxDatGuiGraph::OUTLINE :
+                    v[c++] = glm::vec2(sampleX(0), mRing[mHead]);
+                    v[c++] = glm::vec2(mPlotterRect.width, bottom);
+                    v[c++] = glm::vec2(0, bottom);
+                    v[c++] = oldest;
+                    if (joined) v[c++] = next;
+                    break;
+                case ofxDatGuiGraph::FILLED :
+                    if (!pin) break;
+                    v[c++] = glm::vec2(oldest.x, bottom);
+                    v[c++] = oldest;
+                    if (!joined) break;
+                    v[c++] = glm::vec2(next.x, bottom);
+                    v[c++] = next;
+                    break;
+                case ofxDatGuiGraph::POINTS :
+                    if (pin) v[c++] = oldest;
+                    break;
+                default :
+                    if (!pin) break;
+                    v[c++] = oldest;
+                    if (joined) v[c++] = next;
+                    break;
+            }
+            return c;
+        }
+    
+        int slotVerts()
         {
-            float px = this->x + mPlotterRect.x;
-            float py = this->y + mPlotterRect.y;
-            glLineWidth(mLineWeight);
-            glBegin(GL_LINE_LOOP);
-            glVertex2f(px+mPlotterRect.width, py+mPlotterRect.height);
-            for (int i=0; i<pts.size(); i++) glVertex2f(px+pts[i].x, py+pts[i].y);
-            glVertex2f(px, py+mPlotterRect.height);
-            glEnd();
+            return mDrawMode == ofxDatGuiGraph::FILLED ? 2 : 1;
         }
     
-        void drawLines()
+        int slotOf(int age)
         {
-            float px = this->x + mPlotterRect.x;
-            float py = this->y + mPlotterRect.y;
-            glLineWidth(mLineWeight);
-            glBegin(GL_LINE_STRIP);
-            for (int i=0; i<pts.size(); i++) glVertex2f(px+pts[i].x, py+pts[i].y);
-            glEnd();
+            return (mHead - age + mRing.size()) % mRing.size();
         }
     
-        void drawPoints()
+        bool pinned()
         {
-            float px = this->x + mPlotterRect.x;
-            float py = this->y + mPlotterRect.y;
-            glPointSize(mLineWeight);
-            glLineWidth(mLineWeight);
-            glBegin(GL_POINTS);
-            for (int i=0; i<pts.size(); i++) glVertex2f(px+pts[i].x, py+pts[i].y);
-            glEnd();
+            return mPlotterRect.width - (mCount - 1) * mSpacing <= mSpacing;
+        }
+    
+    // the outline is drawn as strips too, its closing edges come from the extra vertices //
+        GLenum getPrimitive()
+        {
+            switch (mDrawMode) {
+                case ofxDatGuiGraph::LINES : return GL_LINE_STRIP;
+                case ofxDatGuiGraph::POINTS : return GL_POINTS;
+                case ofxDatGuiGraph::OUTLINE : return GL_LINE_STRIP;
+                default : return GL_TRIANGLE_STRIP;
+            }
         }
     
         void setPosition(int x, int y)
         {
             ofxDatGuiComponent::setPosition(x, y);
         }
+    
+    /*
+        samples live in a fixed size ring, the newest one at mHead is drawn at the right edge
+        and each older one mSpacing pixels further left, so adding a sample moves nothing
+    */
+    
+        void setCapacity(int capacity)
+        {
+            if (capacity < 1) capacity = 1;
+            if (capacity == mRing.size()) return;
+        // keep the newest samples that still fit //
+            vector<float> ring(capacity, mPlotterRect.height);
+            int count = min(mCount, capacity);
+            for (int k=0, i=mHead; k<count; k++, i = (i == 0 ? mRing.size() : i) - 1) ring[count-1-k] = mRing[i];
+            mRing.swap(ring);
+            mCount = count;
+            mHead = count > 0 ? count - 1 : capacity - 1;
+            mVertsDirty = true;
+        }
+    
+        void pushSample(float y)
+        {
+            mHead = mHead + 1 == mRing.size() ? 0 : mHead + 1;
+            mRing[mHead] = y;
+            mPending++;
+            mExtrasDirty = true;
+            if (mCount < mRing.size()) mCount++;
+        }
+    
+        void clearSamples()
+        {
+            mCount = 0;
+            mHead = mRing.size() - 1;
+            mVertsDirty = true;
+        }
+    
+    // the oldest sample is pinned to the left edge once it's within a step of it //
+        float sampleX(int k)
+        {
+            float sx = mPlotterRect.width - (k * mSpacing);
+            return sx > mSpacing ? sx : mLineWeight / 2;
+        }
 
-        int mPointSize;
-        int mLineWeight;
-        struct{
-            ofColor lines;
-            ofColor fills;
-        } mColor;
-        vector<ofVec2f> pts;
-        ofRectangle mPlotterRect;
-        void (ofxDatGuiTimeGraph::*mDrawFunc)() = nullptr;
+        vector<float> mRing = vector<float>(1);
+        vector<glm::vec2> mVerts;
+        ofVbo mVbo;
+        int mVboCapacity = 0;
+        int mExtraCount = 0;
+        int mPending = 0;
+        bool mVertsDirty = true;
+        bool mExtrasDirty = true;
+        ofxDatGuiGraph mDrawMode;
+        int mHead = 0;
+        int mCount = 0;
+        float mSpacing = 1.0f;
 };
 
 class ofxDatGuiWaveMonitor : public ofxDatGuiTimeGraph {
@@ -150,7 +330,11 @@ class ofxDatGuiWaveMonitor : public ofxDatGuiTimeGraph {
 
         ofxDatGuiWaveMonitor(string label, float frequency, float amplitude) : ofxDatGuiTimeGraph(label)
         {
+            mAmplitude = 0;
+            mFrequency = 0;
             mFrequencyLimit = 100;
+            mShape = ofxDatGuiWaveform::SINE;
+            mWavetable = &ofxDatGuiWavetable::get(mShape);
             setAmplitude(amplitude);
             setFrequency(frequency);
             mType = ofxDatGuiType::WAVE_MONITOR;
@@ -165,22 +349,50 @@ class ofxDatGuiWaveMonitor : public ofxDatGuiTimeGraph {
     // amplitude is a multiplier that affect the vertical height of the wave and should be a value between 0 & 1 //
         void setAmplitude(float amp)
         {
-            mAmplitude = amp;
-            if (mAmplitude < 0) {
-                mAmplitude = 0;
-            }   else if (mAmplitude > MAX_AMPLITUDE){
-                mAmplitude = MAX_AMPLITUDE;
+            if (mInert) return;
+            if (amp < 0) {
+                amp = 0;
+            }   else if (amp > MAX_AMPLITUDE){
+                amp = MAX_AMPLITUDE;
             }
+            if (amp == mAmplitude) return;
+            mAmplitude = amp;
             graph();
         }
     
    // frequency is a percentage of the limit to ensure the value is always in range //
         void setFrequency(float freq)
         {
-            mFrequency = (freq/mFrequencyLimit)*100.0f;
+            if (mInert) return;
+            freq = (freq/mFrequencyLimit)*100.0f;
+            if (freq == mFrequency) return;
+            mFrequency = freq;
+            graph();
+        }
+    
+        void setWaveform(ofxDatGuiWaveform shape)
+        {
+            if (shape == ofxDatGuiWaveform::CUSTOM) return setWavetable(mCustom);
+            mShape = shape;
+            mWavetable = &ofxDatGuiWavetable::get(shape);
             graph();
         }
     
+    // one cycle of any length, it's resampled to the wavetable's size //
+        void setWavetable(const vector<float>& cycle)
+        {
+            mCustom = cycle;
+            mCustomTable = ofxDatGuiWavetable(cycle);
+            mShape = ofxDatGuiWaveform::CUSTOM;
+            mWavetable = &mCustomTable;
+            graph();
+        }
+    
+        ofxDatGuiWaveform getWaveform()
+        {
+            return mShape;
+        }
+    
         void setFrequencyLimit(float limit)
         {
             mFrequencyLimit = limit;
@@ -201,25 +413,36 @@ class ofxDatGuiWaveMonitor : public ofxDatGuiTimeGraph {
     
         void graph()
         {
-            pts.clear();
-            float step = 1.0/mPlotterRect.width;
+            int width = mPlotterRect.width;
+            if (width < 1) return;
+            setCapacity(width);
+        // rewrite the ring in place from just past the head, the head ends up holding the newest sample //
+            int start = mHead + 1 == width ? 0 : mHead + 1;
+            double step = mFrequency / mPlotterRect.width;
             float yAmp = (mPlotterRect.height/2) * (mAmplitude/float(MAX_AMPLITUDE));
-            for (int i=mPlotterRect.width; i>0; i--) {
-                float yp = mPlotterRect.height/2 + (sin((i*step)*(2*mFrequency)*PI) * yAmp);
-                pts.push_back(ofVec2f(i, yp));
-            }
+            mWavetable->render(&mRing[start], width - start, step, step, mPlotterRect.height/2, yAmp);
+            mWavetable->render(&mRing[0], start, step * (width - start + 1), step, mPlotterRect.height/2, yAmp);
+            mCount = width;
+            mVertsDirty = true;
+            markDirty();
         }
     
         void update(bool ignoreMouseEvents)
         {
-            pts[0].y = pts[pts.size()-1].y;
-            for (int i=mPlotterRect.width-1; i>0; i--) pts[i].y = pts[i-1].y;
+        // scrolling only moves the head, the oldest sample becomes the newest and no slot changes //
+            if (mCount == mRing.size()) mHead = mHead + 1 == mCount ? 0 : mHead + 1;
+            mExtrasDirty = true;
+            markDirty();
         }
     
     private:
         float mAmplitude;
         float mFrequency;
         float mFrequencyLimit;
+        ofxDatGuiWaveform mShape;
+        const ofxDatGuiWavetable* mWavetable;
+        ofxDatGuiWavetable mCustomTable;
+        vector<float> mCustom;
         static const int MAX_AMPLITUDE = 1;
 
 };
@@ -231,6 +454,7 @@ class ofxDatGuiValuePlotter : public ofxDatGuiTimeGraph {
         ofxDatGuiValuePlotter(string label, float min, float max) : ofxDatGuiTimeGraph(label)
         {
             mSpeed = 5.0f;
+            resize();
             setRange(min, max);
             mType = ofxDatGuiType::VALUE_PLOTTER;
         }
@@ -242,6 +466,7 @@ class ofxDatGuiValuePlotter : public ofxDatGuiTimeGraph {
     
         void setRange(float min, float max)
         {
+            if (mInert) return;
             mMin = min;
             mMax = max;
             setValue((max+min)/2);
@@ -250,13 +475,21 @@ class ofxDatGuiValuePlotter : public ofxDatGuiTimeGraph {
         void setSpeed(float speed)
         {
             if (speed != mSpeed){
-                pts.clear();
+                clearSamples();
                 mSpeed = speed;
+                resize();
             }
         }
+    
+        void setWidth(int width, float labelWidth)
+        {
+            ofxDatGuiTimeGraph::setWidth(width, labelWidth);
+            resize();
+        }
 
         void setValue(float value)
         {
+            if (mInert) return;
             mVal = value;
             if (mVal > mMax){
                 mVal = mMax;
@@ -282,29 +515,262 @@ class ofxDatGuiValuePlotter : public ofxDatGuiTimeGraph {
     
         void update(bool ignoreMouseEvents)
         {
-        // shift all points over before adding new value //
-            for (int i=0; i<pts.size(); i++) pts[i].x -= mSpeed;
-            int i = 0;
-            while(i < pts.size())
-            {
-                if (pts.at(i).x <= 0) {
-                    pts.erase(pts.end() - 1);
-                } else if (pts.at(i).x <= mSpeed) {
-                    pts.at(i).x = mLineWeight / 2;
-                }
-                i++;
-            }
-            float height = mPlotterRect.height - (mPlotterRect.height * ofxDatGuiScale(mVal, mMin, mMax));
-            pts.insert(pts.begin(), ofVec2f(mPlotterRect.width, height));
+        // older samples move left because their distance from the newest one grows //
+            pushSample(mPlotterRect.height - (mPlotterRect.height * ofxDatGuiScale(mVal, mMin, mMax)));
+            markDirty();
         }
     
     private:
+    
+    // one sample per mSpeed pixels, plus the one pinned to the left edge //
+        void resize()
+        {
+            mSpacing = mSpeed > 0 ? mSpeed : 1.0f;
+            setCapacity(ceil(mPlotterRect.width / mSpacing));
+        // slot positions depend on the spacing //
+            mVertsDirty = true;
+        }
+    
         float mVal;
         float mMin;
         float mMax;
         float mSpeed;
 };
 
+/*
+    plots several series sampled far faster than the frame rate. producer threads push blocks
+    of samples into a fifo per series, update() drains them and reduces every mSamplesPerColumn
+    samples to the min & max of one pixel column, so a spike between frames is still drawn
+    as a full height band. all series are drawn as bands from a single mesh.
+*/
 
+class ofxDatGuiMultiPlotter : public ofxDatGuiPlot {
 
+    public:
+    
+        static const int kMaxSeries = 16;
 
+        ofxDatGuiMultiPlotter(string label, float min, float max) : ofxDatGuiPlot(label)
+        {
+            setTheme(ofxDatGuiComponent::getTheme());
+            mSamplesPerColumn = 1;
+            mMeshDirty = true;
+            mMesh.setMode(OF_PRIMITIVE_TRIANGLE_STRIP);
+            mMesh.setUsage(GL_STREAM_DRAW);
+            setRange(min, max);
+            mType = ofxDatGuiType::MULTI_PLOTTER;
+        }
+    
+        static ofxDatGuiMultiPlotter* getInstance()
+        {
+            return new ofxDatGuiMultiPlotter("X", 0, 1);
+        }
+    
+    /*
+        the series live in fixed slots that never move, a new one is published after it's been
+        built so producers of the existing series can keep pushing while it's added.
+        returns the new series' index or -1 once all kMaxSeries slots are taken
+    */
+        int addSeries(ofColor color, size_t fifoSize = 8192)
+        {
+            if (mInert) return -1;
+            int n = mNumSeries.load(std::memory_order_relaxed);
+            if (n == kMaxSeries){
+                ofLogError() << "ofxDatGuiMultiPlotter->addSeries() can't add more than " << kMaxSeries << " series";
+                return -1;
+            }
+            mSeries[n].reset(new Series(fifoSize));
+            mSeries[n]->color = color;
+            resize(*mSeries[n]);
+            mNumSeries.store(n + 1, std::memory_order_release);
+            return n;
+        }
+    
+        int getNumSeries()
+        {
+            return mNumSeries.load(std::memory_order_acquire);
+        }
+    
+        void setSeriesColor(int series, ofColor color)
+        {
+            if (series < 0 || series >= getNumSeries()) return;
+            mSeries[series]->color = color;
+            mMeshDirty = true;
+            markDirty();
+        }
+    
+    // safe to call from one producer thread per series, returns how many samples fit in the fifo //
+        size_t push(int series, const float* values, size_t count)
+        {
+            if (mInert) return 0;
+            assert(series >= 0 && series < getNumSeries());
+            if (series < 0 || series >= getNumSeries()) return 0;
+            return mSeries[series]->fifo.push(values, count);
+        }
+    
+        size_t push(int series, float value)
+        {
+            return push(series, &value, 1);
+        }
+    
+    // how many samples are reduced to one pixel column //
+        void setSamplesPerColumn(int samples)
+        {
+            if (samples < 1) samples = 1;
+            if (samples == mSamplesPerColumn) return;
+            mSamplesPerColumn = samples;
+            for (int i=0; i<getNumSeries(); i++) resize(*mSeries[i]);
+        }
+    
+        int getSamplesPerColumn()
+        {
+            return mSamplesPerColumn;
+        }
+    
+        void setRange(float min, float max)
+        {
+            if (mInert) return;
+            mMin = min;
+            mMax = max;
+            mMeshDirty = true;
+            markDirty();
+        }
+    
+        float getMin()
+        {
+            return mMin;
+        }
+    
+        float getMax()
+        {
+            return mMax;
+        }
+    
+        void setWidth(int width, float labelWidth)
+        {
+            ofxDatGuiPlot::setWidth(width, labelWidth);
+            for (int i=0; i<getNumSeries(); i++) resize(*mSeries[i]);
+        }
+    
+        void update(bool ignoreMouseEvents)
+        {
+            for (int i=0; i<getNumSeries(); i++){
+                Series* series = mSeries[i].get();
+                if (series->fifo.consume([this, series](const float* v, size_t n){ reduce(*series, v, n); }) > 0){
+                    mMeshDirty = true;
+                }
+            }
+            if (mMeshDirty) markDirty();
+        }
+    
+    protected:
+    
+        void draw()
+        {
+            if (!mVisible) return;
+            ofxDatGuiRenderState::push();
+                ofxDatGuiComponent::draw();
+                ofxDatGuiRenderer::rect(x + mPlotterRect.x, y + mPlotterRect.y, mPlotterRect.width, mPlotterRect.height, mStyle.color.inputArea);
+                ofxDatGuiRenderer::sync();
+                if (mMeshDirty) buildMesh();
+                if (mMesh.getNumVertices() > 0){
+                    ofPushMatrix();
+                    ofTranslate(x + mPlotterRect.x, y + mPlotterRect.y);
+                    mMesh.draw();
+                    ofPopMatrix();
+                }
+            ofxDatGuiRenderState::pop();
+        }
+    
+    private:
+    
+    // the columns are a ring like the one of the other time graphs, one column per pixel //
+        struct Series {
+            Series(size_t fifoSize) : fifo(fifoSize) {}
+            ofxDatGuiFifo<float> fifo;
+            ofColor color;
+            vector<float> lo;
+            vector<float> hi;
+            int head = 0;
+            int count = 0;
+            int fill = 0;
+            float colLo = FLT_MAX;
+            float colHi = -FLT_MAX;
+        };
+    
+        void resize(Series& s)
+        {
+            int columns = max(1, (int)mPlotterRect.width);
+            s.lo.assign(columns, 0);
+            s.hi.assign(columns, 0);
+            s.head = columns - 1;
+            s.count = 0;
+            s.fill = 0;
+            s.colLo = FLT_MAX;
+            s.colHi = -FLT_MAX;
+            mMeshDirty = true;
+        }
+    
+        void reduce(Series& s, const float* v, size_t n)
+        {
+            while (n > 0){
+                size_t take = min(n, (size_t)(mSamplesPerColumn - s.fill));
+                ofxDatGuiMinMax(v, take, s.colLo, s.colHi);
+                s.fill += take;
+                v += take;
+                n -= take;
+                if (s.fill == mSamplesPerColumn){
+                    s.head = s.head + 1 == s.lo.size() ? 0 : s.head + 1;
+                    s.lo[s.head] = s.colLo;
+                    s.hi[s.head] = s.colHi;
+                    if (s.count < s.lo.size()) s.count++;
+                    s.fill = 0;
+                    s.colLo = FLT_MAX;
+                    s.colHi = -FLT_MAX;
+                }
+            }
+        }
+    
+    // one triangle strip for all series, degenerate triangles join the bands //
+        void buildMesh()
+        {
+            mMeshDirty = false;
+            mMesh.clear();
+            float h = mPlotterRect.height;
+            float minHeight = max(1, mLineWeight);
+            for (int i=0; i<getNumSeries(); i++){
+                Series* s = mSeries[i].get();
+                if (s->count == 0) continue;
+                ofFloatColor c = s->color;
+                bool first = true;
+                for (int k=0, i=s->head; k<s->count; k++, i = (i == 0 ? s->lo.size() : i) - 1) {
+                    float sx = mPlotterRect.width - k;
+                    float top = h - (h * ofxDatGuiScale(s->hi[i], mMin, mMax));
+                    float bottom = h - (h * ofxDatGuiScale(s->lo[i], mMin, mMax));
+                    if (bottom - top < minHeight){
+                        top = (top + bottom - minHeight) / 2;
+                        bottom = top + minHeight;
+                    }
+                    if (first && mMesh.getNumVertices() > 0){
+                        mMesh.addVertex(mMesh.getVertices().back());
+                        mMesh.addColor(mMesh.getColors().back());
+                        mMesh.addVertex(glm::vec3(sx, top, 0));
+                        mMesh.addColor(c);
+                    }
+                    first = false;
+                    mMesh.addVertex(glm::vec3(sx, top, 0));
+                    mMesh.addColor(c);
+                    mMesh.addVertex(glm::vec3(sx, bottom, 0));
+                    mMesh.addColor(c);
+                }
+            }
+        }
+    
+        unique_ptr<Series> mSeries[kMaxSeries];
+        std::atomic<int> mNumSeries{0};
+        ofVboMesh mMesh;
+        bool mMeshDirty;
+        int mSamplesPerColumn;
+        float mMin;
+        float mMax;
+};
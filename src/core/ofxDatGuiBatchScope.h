@@ -0,0 +1,27 @@
+#pragma once
+
+// Scoped beginBatch() / endBatch() for anything that can defer its layout
+// while many components are added to it (ofxDatGui, ofxDatGuiFolder).
+//
+//	{
+//		ofxDatGuiBatchScope<ofxDatGui> batch(gui);
+//		for (auto & p : params) gui->addSlider(p);
+//	} // laid out once, here
+template <typename T>
+class ofxDatGuiBatchScope {
+public:
+	explicit ofxDatGuiBatchScope(T * target)
+		: mTarget(target) {
+		if (mTarget != nullptr) mTarget->beginBatch();
+	}
+
+	~ofxDatGuiBatchScope() {
+		if (mTarget != nullptr) mTarget->endBatch();
+	}
+
+	ofxDatGuiBatchScope(const ofxDatGuiBatchScope &) = delete;
+	ofxDatGuiBatchScope & operator=(const ofxDatGuiBatchScope &) = delete;
+
+private:
+	T * mTarget;
+};
@@ -21,10 +21,24 @@
 */
 
 #include "ofxDatGuiComponent.h"
+#include "ofxDatGuiLookupIndex.h"
+#include <cctype>
 
 // One global owner for any active mouse press
 static ofxDatGuiComponent * sPressOwner = nullptr;
 
+// Components currently hovered, they stay input candidates until the mouse leaves them
+static vector<ofxDatGuiComponent *> sHovered;
+// Components showing a popup over the rows below them, most recently opened last
+static vector<ofxDatGuiComponent *> sPopups;
+// True while a gui resolves input only for the components it marked as candidates
+static bool sIndexedInput = false;
+
+#ifdef OFX_DATGUI_PROFILE
+ofxDatGuiStats * ofxDatGuiProfiler::sActive = nullptr;
+ofxDatGuiProfiler::ComponentScope * ofxDatGuiProfiler::sScope = nullptr;
+#endif
+
 bool ofxDatGuiLog::mQuiet = false;
 string ofxDatGuiTheme::AssetPath = "";
 std::unique_ptr<ofxDatGuiTheme> ofxDatGuiComponent::theme;
@@ -32,26 +46,51 @@ std::unique_ptr<ofxDatGuiTheme> ofxDatGuiComponent::theme;
 ofxDatGuiComponent::ofxDatGuiComponent(string label)
 {
     mName = label;
+    mNameKey = foldName(label);
     mVisible = true;
     mEnabled = true;
     mFocused = false;
     mMouseOver = false;
     mMouseDown = false;
+    mDirty = true;
+    mInputCandidate = false;
+    mRowStore = nullptr;
+    mRow = -1;
+    mEventQueue = nullptr;
+    mLookupIndex = nullptr;
+    mDelivery = ofxDatGuiDelivery::EVERY_CHANGE;
+    mDeliveryInterval = 0;
+    mLastDelivery = -1;
+    mEventPending = false;
     mStyle.opacity = 255;
     this->x = 0; this->y = 0;
     mAnchor = ofxDatGuiAnchor::NO_ANCHOR;
     mLabel.text = label;
+    mLabel.measuredWith = nullptr;
     mLabel.alignment = ofxDatGuiAlignment::LEFT;
 }
 
+void* ofxDatGuiComponent::operator new(size_t size)
+{
+    return ofxDatGuiPool::allocate(size);
+}
+
+void ofxDatGuiComponent::operator delete(void* p, size_t size)
+{
+    ofxDatGuiPool::release(p, size);
+}
+
 ofxDatGuiComponent::~ofxDatGuiComponent()
 {
 //  cout << "ofxDatGuiComponent "<< mName << " destroyed" << endl;
-    ofRemoveListener(ofEvents().keyPressed, this, &ofxDatGuiComponent::onKeyPressed);
-    ofRemoveListener(ofEvents().windowResized, this, &ofxDatGuiComponent::onWindowResized);
+    ofxDatGuiInput::remove(this);
 
 	// Clear mouse press ownership
 	if (sPressOwner == this) sPressOwner = nullptr;
+	sHovered.erase(std::remove(sHovered.begin(), sHovered.end(), this), sHovered.end());
+	setPopupOpen(false);
+	if (mEventPending && mEventQueue != nullptr) mEventQueue->remove(this);
+	if (mLookupIndex != nullptr) mLookupIndex->erase(this);
 }
 
 /*
@@ -71,7 +110,11 @@ int ofxDatGuiComponent::getIndex()
 
 void ofxDatGuiComponent::setName(string name)
 {
+    if (mInert) return;
+    string oldKey = mNameKey;
     mName = name;
+    mNameKey = foldName(name);
+    if (mLookupIndex != nullptr) mLookupIndex->rename(this, oldKey);
 }
 
 string ofxDatGuiComponent::getName()
@@ -81,7 +124,20 @@ string ofxDatGuiComponent::getName()
 
 bool ofxDatGuiComponent::is(string name)
 {
-    return ofToLower(mName) == ofToLower(name);
+    return mNameKey == foldName(name);
+}
+
+string ofxDatGuiComponent::foldName(const string &name)
+{
+    string folded;
+    foldName(name, folded);
+    return folded;
+}
+
+void ofxDatGuiComponent::foldName(const string &name, string &folded)
+{
+    folded.assign(name);
+    for (char &c : folded) c = (char)std::tolower((unsigned char)c);
 }
 
 ofxDatGuiType ofxDatGuiComponent::getType()
@@ -112,6 +168,7 @@ void ofxDatGuiComponent::setComponentStyle(const ofxDatGuiTheme* theme)
     mStyle.border.visible = theme->border.visible;
     mStyle.guiBackground = theme->color.guiBackground;
     mFont = theme->font.ptr;
+    markDirty();
     mIcon.y = mStyle.height * .33;
     mIcon.color = theme->color.icons;
     mIcon.size = theme->layout.iconSize;
@@ -126,6 +183,7 @@ void ofxDatGuiComponent::setComponentStyle(const ofxDatGuiTheme* theme)
 void ofxDatGuiComponent::setWidth(int width, float labelWidth)
 {
     mStyle.width = width;
+    markDirty();
     if (labelWidth > 1){
 // we received a pixel value //
         mLabel.width = labelWidth;
@@ -169,6 +227,9 @@ void ofxDatGuiComponent::setPosition(int x, int y)
 void ofxDatGuiComponent::setVisible(bool visible)
 {
     mVisible = visible;
+    markDirty();
+    setRowFlag(ofxDatGuiRowStore::VISIBLE, visible, true);
+    ofxDatGuiInput::invalidate();
 
 	if (!visible && sPressOwner == this) sPressOwner = nullptr;
 
@@ -185,12 +246,15 @@ bool ofxDatGuiComponent::getVisible()
 
 void ofxDatGuiComponent::setOpacity(float opacity)
 {
+    markDirty();
     mStyle.opacity = opacity * 255;
     for (int i=0; i<children.size(); i++) children[i]->setOpacity(opacity);
 }
 
 void ofxDatGuiComponent::setEnabled(bool enabled)
 {
+    markDirty();
+    ofxDatGuiInput::invalidate();
     mEnabled = enabled;
 }
 
@@ -218,6 +282,80 @@ bool ofxDatGuiComponent::getMouseDown()
     return mMouseDown;
 }
 
+void ofxDatGuiComponent::markDirty()
+{
+    mDirty = true;
+    setRowFlag(ofxDatGuiRowStore::DIRTY, true, false);
+}
+
+bool ofxDatGuiComponent::isDirty(bool recursive)
+{
+    if (mDirty || !recursive) return mDirty;
+    for (int i=0; i<children.size(); i++) if (children[i]->isDirty()) return true;
+    return false;
+}
+
+void ofxDatGuiComponent::bindRow(ofxDatGuiRowStore* rows, int row)
+{
+    mRowStore = rows;
+    mRow = row;
+    setRowFlag(ofxDatGuiRowStore::VISIBLE, mVisible, true);
+    setRowFlag(ofxDatGuiRowStore::HOVER, mMouseOver, true);
+    if (mMouseDown) setRowFlag(ofxDatGuiRowStore::PRESS, true, false);
+    if (mDirty) setRowFlag(ofxDatGuiRowStore::DIRTY, true, false);
+    for (int i=0; i<children.size(); i++) children[i]->bindRow(rows, row);
+}
+
+void ofxDatGuiComponent::bindEventQueue(ofxDatGuiEventQueue* queue)
+{
+    if (mEventQueue != queue && mEventPending){
+    // hand a held back event over to the new queue //
+        if (mEventQueue != nullptr) mEventQueue->remove(this);
+        if (queue != nullptr) queue->push(this);
+    }
+    mEventQueue = queue;
+    for (int i=0; i<children.size(); i++) children[i]->bindEventQueue(queue);
+}
+
+void ofxDatGuiComponent::bindLookupIndex(ofxDatGuiLookupIndex* index)
+{
+    mLookupIndex = index;
+}
+
+void ofxDatGuiComponent::adoptChild(ofxDatGuiComponent* child)
+{
+// join the gui we are already part of, without it rebuilding anything //
+    if (mLookupIndex != nullptr) mLookupIndex->insert(this, child);
+    if (mRowStore != nullptr) child->bindRow(mRowStore, mRow);
+    if (mEventQueue != nullptr) child->bindEventQueue(mEventQueue);
+}
+
+void ofxDatGuiComponent::setRowFlag(uint8_t flag, bool on, bool ownOnly)
+{
+    if (mRowStore == nullptr || mRow < 0 || mRow >= mRowStore->size()) return;
+    if (ownOnly && mRowStore->component(mRow) != this) return;
+    mRowStore->setFlag(mRow, flag, on);
+}
+
+void ofxDatGuiComponent::clearDirty()
+{
+// remember where we were drawn so that region can be repaired when we move or shrink //
+    mDirty = false;
+    mDrawBounds = getDrawBounds();
+    for (int i=0; i<children.size(); i++) children[i]->clearDirty();
+}
+
+ofRectangle ofxDatGuiComponent::getLastDrawBounds()
+{
+    return mDrawBounds;
+}
+
+ofRectangle ofxDatGuiComponent::getDrawBounds()
+{
+    int b = mStyle.border.visible ? mStyle.border.width : 0;
+    return ofRectangle(x-b, y-b, getWidth()+(b*2), getHeight()+(b*2));
+}
+
 void ofxDatGuiComponent::setMask(const ofRectangle &mask)
 {
     mMask = mask;
@@ -227,15 +365,66 @@ void ofxDatGuiComponent::setMask(const ofRectangle &mask)
 void ofxDatGuiComponent::clearGlobalPressOwner() { sPressOwner = nullptr; }
 bool ofxDatGuiComponent::isAnyPressActive() { return sPressOwner != nullptr; }
 
+/*
+    indexed input
+*/
 
-void ofxDatGuiComponent::setAnchor(ofxDatGuiAnchor anchor)
+void ofxDatGuiComponent::markInputCandidate(const ofPoint & m)
 {
-    mAnchor = anchor;
-    if (mAnchor != ofxDatGuiAnchor::NO_ANCHOR){
-        ofAddListener(ofEvents().windowResized, this, &ofxDatGuiComponent::onWindowResized);
+    mInputCandidate = true;
+// indexed containers only pass the mark on to the row under the mouse //
+    if (mChildIndex.isActive()){
+        ofxDatGuiComponent* c = mChildIndex.find(m.y);
+        if (c != nullptr) c->markInputCandidate(m);
     }   else{
-        ofRemoveListener(ofEvents().windowResized, this, &ofxDatGuiComponent::onWindowResized);
+        for (auto c : children) c->markInputCandidate(m);
+    }
+}
+
+void ofxDatGuiComponent::beginIndexedInput()
+{
+// the press owner and anything still hovered must see the mouse leave or release //
+    if (sPressOwner != nullptr) sPressOwner->mInputCandidate = true;
+    for (auto c : sHovered) c->mInputCandidate = true;
+    sIndexedInput = true;
+}
+
+void ofxDatGuiComponent::endIndexedInput()
+{
+    sIndexedInput = false;
+}
+
+void ofxDatGuiComponent::setPopupOpen(bool open)
+{
+    auto it = std::find(sPopups.begin(), sPopups.end(), this);
+    if (open && it == sPopups.end()){
+        sPopups.push_back(this);
+    }   else if (!open && it != sPopups.end()){
+        sPopups.erase(it);
+    }
+    ofxDatGuiInput::invalidate();
+}
+
+ofxDatGuiComponent* ofxDatGuiComponent::getPopupAt(const ofPoint & m)
+{
+// the draw bounds of a component with an open popup include the popup //
+    for (auto it = sPopups.rbegin(); it != sPopups.rend(); ++it){
+        if ((*it)->getVisible() && (*it)->getDrawBounds().inside(m)) return *it;
+    }
+    return nullptr;
+}
+
+
+void ofxDatGuiComponent::setAnchor(ofxDatGuiAnchor anchor)
+{
+// resize targets are counted, only hold one reference for being anchored at all //
+// so dropping the anchor leaves any other registration (a 2d pad's own) alone //
+    if (anchor != ofxDatGuiAnchor::NO_ANCHOR && mAnchor == ofxDatGuiAnchor::NO_ANCHOR){
+        ofxDatGuiInput::setResizeTarget(this, true);
+    }   else if (anchor == ofxDatGuiAnchor::NO_ANCHOR && mAnchor != ofxDatGuiAnchor::NO_ANCHOR){
+        ofxDatGuiInput::setResizeTarget(this, false);
     }
+    mAnchor = anchor;
     onWindowResized();
 }
 
@@ -250,10 +439,18 @@ bool ofxDatGuiComponent::getIsExpanded()
 
 void ofxDatGuiComponent::setLabel(string label)
 {
+    if (mInert) return;
     mLabel.text = label;
-    mLabel.rendered = mLabel.forceUpperCase ? ofToUpper(mLabel.text) : mLabel.rendered = mLabel.text;
-    mLabel.rect = mFont->rect(mLabel.rendered);
+    string rendered = mLabel.forceUpperCase ? ofToUpper(mLabel.text) : mLabel.text;
+// re-applying a theme sets the same label again, only measure it when the text or font changed //
+    if (rendered != mLabel.rendered || mFont.get() != mLabel.measuredWith){
+        mLabel.rendered = rendered;
+        mLabel.rect = mFont->rect(mLabel.rendered);
+        mLabel.measuredWith = mFont.get();
+        mLabel.glyphs.invalidate();
+    }
     positionLabel();
+    markDirty();
 }
 
 string ofxDatGuiComponent::getLabel()
@@ -263,6 +460,7 @@ string ofxDatGuiComponent::getLabel()
 
 void ofxDatGuiComponent::setLabelColor(ofColor c)
 {
+    markDirty();
     mLabel.color = c;
 }
 
@@ -285,6 +483,7 @@ bool ofxDatGuiComponent::getLabelUpperCase()
 void ofxDatGuiComponent::setLabelAlignment(ofxDatGuiAlignment align)
 {
     mLabel.alignment = align;
+    markDirty();
     for (int i=0; i<children.size(); i++) children[i]->setLabelAlignment(align);
     positionLabel();
 }
@@ -306,6 +505,7 @@ void ofxDatGuiComponent::positionLabel()
 
 void ofxDatGuiComponent::setBackgroundColor(ofColor color)
 {
+    markDirty();
     mStyle.color.background = color;
 }
 
@@ -321,6 +521,7 @@ void ofxDatGuiComponent::setBackgroundColorOnMouseDown(ofColor color)
 
 void ofxDatGuiComponent::setBackgroundColors(ofColor c1, ofColor c2, ofColor c3)
 {
+    markDirty();
     mStyle.color.background = c1;
     mStyle.color.onMouseOver = c2;
     mStyle.color.onMouseDown = c3;
@@ -328,27 +529,32 @@ void ofxDatGuiComponent::setBackgroundColors(ofColor c1, ofColor c2, ofColor c3)
 
 void ofxDatGuiComponent::setStripe(ofColor color, int width)
 {
+    markDirty();
     mStyle.stripe.color = color;
     mStyle.stripe.width = width;
 }
 
 void ofxDatGuiComponent::setStripeColor(ofColor color)
 {
+    markDirty();
     mStyle.stripe.color = color;
 }
 
 void ofxDatGuiComponent::setStripeWidth(int width)
 {
+    markDirty();
     mStyle.stripe.width = width;
 }
 
 void ofxDatGuiComponent::setStripeVisible(bool visible)
 {
+    markDirty();
     mStyle.stripe.visible = visible;
 }
 
 // LoopyDev: Stripe config
 void ofxDatGuiComponent::setStripePosition(StripePosition position) {
+	markDirty();
 	mStyle.stripe.position = position;
 }
 
@@ -359,6 +565,7 @@ ofxDatGuiComponent::StripePosition ofxDatGuiComponent::getStripePosition() const
 
 void ofxDatGuiComponent::setBorder(ofColor color, int width)
 {
+    markDirty();
     mStyle.border.color = color;
     mStyle.border.width = width;
     mStyle.border.visible = true;
@@ -366,6 +573,7 @@ void ofxDatGuiComponent::setBorder(ofColor color, int width)
 
 void ofxDatGuiComponent::setBorderVisible(bool visible)
 {
+    markDirty();
     mStyle.border.visible = visible;
 }
 
@@ -373,28 +581,37 @@ void ofxDatGuiComponent::setBorderVisible(bool visible)
     draw methods
 */
 
-// Only true on the exact frame the mouse transitions Up > Down
-static bool mousePressedThisFrame() {
-	static bool prev = false;
-	static bool thisFrame = false;
-	static uint64_t seenFrame = std::numeric_limits<uint64_t>::max();
-
-	uint64_t f = ofGetFrameNum();
-	if (f != seenFrame) {
-		bool mp = ofGetMousePressed();
-		thisFrame = mp && !prev;
-		prev = mp;
-		seenFrame = f;
+void ofxDatGuiComponent::update(bool acceptEvents) {
+	// Remember the interaction state so any visual change flags a redraw.
+	const bool wasOver = mMouseOver;
+	const bool wasDown = mMouseDown;
+	const bool wasFocused = mFocused;
+
+	// Idle frame: the mouse hasn't moved or clicked and nothing moved under it.
+	const bool hasInput = ofxDatGuiInput::get().hasInput;
+	// Inside an indexed gui pass only the marked candidates look at the mouse.
+	if (hasInput && (!sIndexedInput || mInputCandidate)) resolveInput(acceptEvents);
+	mInputCandidate = false;
+
+	// Dragging usually changes a value, so keep redrawing while we own the press.
+	if (wasOver != mMouseOver || wasDown != mMouseDown || wasFocused != mFocused || (hasInput && sPressOwner == this)) markDirty();
+
+	if (this->getIsExpanded()) {
+		for (int i = 0; i < children.size(); ++i) {
+			if (!children[i]->getVisible()) continue;
+			OFX_DATGUI_PROFILE_COMPONENT(children[i], UPDATE);
+			children[i]->update(acceptEvents);
+		}
 	}
-	return thisFrame;
 }
 
-void ofxDatGuiComponent::update(bool acceptEvents) {
-	const bool mp = ofGetMousePressed();
-	const bool justPressed = mousePressedThisFrame(); // only true on the transition frame
+void ofxDatGuiComponent::resolveInput(bool acceptEvents) {
+	const ofxDatGuiInput::Snapshot & input = ofxDatGuiInput::get();
+	const bool mp = input.pressed;
+	const bool justPressed = input.justPressed; // only true on the transition frame
 
 	// Absolute mouse (same space as component x/y)
-	const ofPoint mouseAbs(ofGetMouseX(), ofGetMouseY());
+	const ofPoint mouseAbs = input.mouse;
 
 	// Local to mask (only for vertical clip test)
 	const ofPoint mouseLocal(mouseAbs.x - mMask.x, mouseAbs.y - mMask.y);
@@ -402,9 +619,12 @@ void ofxDatGuiComponent::update(bool acceptEvents) {
 	 // Only allow hover/highlight when not pressed, or when THIS component owns the press.
 	const bool hoverAllowed = !(mp && sPressOwner != this);
 
-	const bool overGeom = hitTest(mouseAbs) && (mMask.height <= 0 || (mouseLocal.y >= 0 && mouseLocal.y <= mMask.height));
+	// An open popup takes the mouse ahead of every row it covers, whatever order they update in.
+	const ofxDatGuiComponent * popup = sPopups.empty() ? nullptr : getPopupAt(mouseAbs);
+	const bool covered = popup != nullptr && popup != this;
+	const bool overGeom = !covered && hitTest(mouseAbs) && (mMask.height <= 0 || (mouseLocal.y >= 0 && mouseLocal.y <= mMask.height));
 	// If this is an expanded container, don't steal presses that begin in the child area (below header).
-	const bool pressInChildRegion = getIsExpanded() && !children.empty() && (ofGetMouseY() > y + mStyle.height);
+	const bool pressInChildRegion = getIsExpanded() && !children.empty() && (mouseAbs.y > y + mStyle.height);
 
 	// Block highlighting on drag-in or while another widget owns the press:
 	const bool over = hoverAllowed && overGeom;
@@ -412,6 +632,11 @@ void ofxDatGuiComponent::update(bool acceptEvents) {
 	if (over && !mMouseOver) onMouseEnter(mouseAbs);
 	if (!over && mMouseOver) onMouseLeave(mouseAbs);
 
+	// Keep hovered components on the candidate list until they see the mouse leave.
+	auto hovered = std::find(sHovered.begin(), sHovered.end(), this);
+	if (mMouseOver && hovered == sHovered.end()) sHovered.push_back(this);
+	if (!mMouseOver && hovered != sHovered.end()) sHovered.erase(hovered);
+
 	if (acceptEvents && mEnabled && mVisible) {
 		if (mp) {
 			if (sPressOwner == this) {
@@ -420,7 +645,7 @@ void ofxDatGuiComponent::update(bool acceptEvents) {
 			} else if (sPressOwner == nullptr && overGeom && justPressed && !pressInChildRegion) {
 				// Start a brand new press only if it BEGAN here, this frame
 				sPressOwner = this;
-				mMouseDown = true;
+				setMouseDown(true);
 				onMousePress(mouseAbs);
 				if (!mFocused) onFocus();
 			}
@@ -429,18 +654,10 @@ void ofxDatGuiComponent::update(bool acceptEvents) {
 			if (sPressOwner == this) {
 				// Mouse went up; we were the owner ? release, even if mMouseDown was toggled elsewhere
 				onMouseRelease(mouseAbs);
-				mMouseDown = false;
+				setMouseDown(false);
 				sPressOwner = nullptr;
 			}
 		}
-
-	}
-
-	if (this->getIsExpanded()) {
-		for (int i = 0; i < children.size(); ++i) {
-			if (!children[i]->getVisible()) continue;
-			children[i]->update(acceptEvents);
-		}
 	}
 }
 
@@ -449,29 +666,32 @@ void ofxDatGuiComponent::update(bool acceptEvents) {
 void ofxDatGuiComponent::draw()
 {
 
-    ofPushStyle();
+    ofxDatGuiRenderState::push();
         if (mStyle.border.visible) drawBorder();
         drawBackground();
         drawLabel();
         if (mStyle.stripe.visible) drawStripe();
-    ofPopStyle();
+    ofxDatGuiRenderState::pop();
 }
 
 void ofxDatGuiComponent::drawBackground()
 {
-    ofFill();
-    ofSetColor(mStyle.color.background, mStyle.opacity);
-    ofDrawRectangle(x, y, mStyle.width, mStyle.height);
+    ofxDatGuiRenderer::rect(x, y, mStyle.width, mStyle.height, ofColor(mStyle.color.background, mStyle.opacity));
 }
 
 void ofxDatGuiComponent::drawLabel()
 {
-    ofSetColor(mLabel.color);
-    if (mType != ofxDatGuiType::DROPDOWN_OPTION){
-        mFont->draw(mLabel.rendered, x+mLabel.x, y+mStyle.height/2 + mLabel.rect.height/2);
-    }   else{
-        mFont->draw("* "+mLabel.rendered, x+mLabel.x, y+mStyle.height/2 + mLabel.rect.height/2);
+    int lx = x + mLabel.x;
+    int ly = y + mStyle.height/2 + mLabel.rect.height/2;
+// the glyph quads are only rebuilt when the text, font or position changed //
+    if (!mLabel.glyphs.valid(mFont, lx, ly)){
+        if (mType != ofxDatGuiType::DROPDOWN_OPTION){
+            mLabel.glyphs.build(mFont, mLabel.rendered, lx, ly);
+        }   else{
+            mLabel.glyphs.build(mFont, "* "+mLabel.rendered, lx, ly);
+        }
     }
+    ofxDatGuiRenderer::glyphs(mLabel.glyphs, mLabel.color);
 }
 
 //void ofxDatGuiComponent::drawStripe()
@@ -482,24 +702,24 @@ void ofxDatGuiComponent::drawLabel()
 void ofxDatGuiComponent::drawStripe() {
 	if (!mStyle.stripe.visible || mStyle.stripe.width <= 0) return;
 
-	ofSetColor(mStyle.stripe.color);
+	const ofColor & c = mStyle.stripe.color;
 	int w = mStyle.stripe.width;
 
 	switch (mStyle.stripe.position) {
 	case StripePosition::LEFT:
-		ofDrawRectangle(x, y, w, mStyle.height);
+		ofxDatGuiRenderer::rect(x, y, w, mStyle.height, c);
 		break;
 
 	case StripePosition::RIGHT:
-		ofDrawRectangle(x + mStyle.width - w, y, w, mStyle.height);
+		ofxDatGuiRenderer::rect(x + mStyle.width - w, y, w, mStyle.height, c);
 		break;
 
 	case StripePosition::TOP:
-		ofDrawRectangle(x, y, mStyle.width, w);
+		ofxDatGuiRenderer::rect(x, y, mStyle.width, w, c);
 		break;
 
 	case StripePosition::BOTTOM:
-		ofDrawRectangle(x, y + mStyle.height - w, mStyle.width, w);
+		ofxDatGuiRenderer::rect(x, y + mStyle.height - w, mStyle.width, w, c);
 		break;
 	}
 }
@@ -507,10 +727,8 @@ void ofxDatGuiComponent::drawStripe() {
 
 void ofxDatGuiComponent::drawBorder()
 {
-    ofFill();
     int w = mStyle.border.width;
-    ofSetColor(mStyle.border.color, mStyle.opacity);
-    ofDrawRectangle(x-w, y-w, mStyle.width+(w*2), mStyle.height+(w*2));
+    ofxDatGuiRenderer::rect(x-w, y-w, mStyle.width+(w*2), mStyle.height+(w*2), ofColor(mStyle.border.color, mStyle.opacity));
 }
 
 void ofxDatGuiComponent::drawColorPicker() { }
@@ -528,34 +746,106 @@ bool ofxDatGuiComponent::hitTest(ofPoint m)
 void ofxDatGuiComponent::onMouseEnter(ofPoint m)
 {
     mMouseOver = true;
+    setRowFlag(ofxDatGuiRowStore::HOVER, true, true);
 }
 
 void ofxDatGuiComponent::onMouseLeave(ofPoint m)
 {
     mMouseOver = false;
+    setRowFlag(ofxDatGuiRowStore::HOVER, false, true);
 }
 
 void ofxDatGuiComponent::onMousePress(ofPoint m)
 {
-    mMouseDown = true;
+    setMouseDown(true);
 }
 
 void ofxDatGuiComponent::onMouseRelease(ofPoint m)
 {
-    mMouseDown = false;
+    setMouseDown(false);
+}
+
+void ofxDatGuiComponent::setMouseDown(bool down)
+{
+// only one component holds the press at a time, so it can set and clear its row's flag on its own //
+    if (mMouseDown == down) return;
+    mMouseDown = down;
+    setRowFlag(ofxDatGuiRowStore::PRESS, down, false);
+// without a gui to flush it, an event held until release goes out right here //
+    if (!down && mEventPending && mEventQueue == nullptr) deliverPendingEvent();
+}
+
+/*
+    event delivery
+*/
+
+void ofxDatGuiComponent::setDelivery(ofxDatGuiDelivery policy, float maxHz)
+{
+    mDelivery = policy;
+    mDeliveryInterval = maxHz > 0 ? 1.0f / maxHz : 0;
+}
+
+ofxDatGuiDelivery ofxDatGuiComponent::getDelivery()
+{
+    return mDelivery;
+}
+
+void ofxDatGuiComponent::emitEvent()
+{
+// outside of a gui nothing flushes once per frame, held events wait for release or the throttle //
+    if (mEventQueue != nullptr && (mDelivery != ofxDatGuiDelivery::EVERY_CHANGE || mEventQueue->getQueued())){
+    // only the first change of a frame queues us, later ones just move the value //
+        if (!mEventPending) mEventQueue->push(this);
+        mEventPending = true;
+    }   else if (mEventQueue == nullptr && !eventDue()){
+        mEventPending = true;
+    }   else{
+        deliverPendingEvent();
+    }
+}
+
+void ofxDatGuiComponent::deliverEvent() { }
+
+bool ofxDatGuiComponent::eventDue()
+{
+    switch (mDelivery) {
+        case ofxDatGuiDelivery::ON_RELEASE:
+            return !mMouseDown;
+        case ofxDatGuiDelivery::THROTTLED:
+            return !mMouseDown || mLastDelivery < 0 || ofGetElapsedTimef() - mLastDelivery >= mDeliveryInterval;
+        default:
+            return true;
+    }
+}
+
+bool ofxDatGuiComponent::flushEvent()
+{
+    if (!mEventPending) return true;
+    if (!eventDue()) return false;
+    deliverPendingEvent();
+    return true;
+}
+
+void ofxDatGuiComponent::deliverPendingEvent()
+{
+    mEventPending = false;
+    mLastDelivery = ofGetElapsedTimef();
+    deliverEvent();
 }
 
 void ofxDatGuiComponent::onFocus()
 {
     mFocused = true;
-    ofAddListener(ofEvents().keyPressed, this, &ofxDatGuiComponent::onKeyPressed);
+    markDirty();
+    ofxDatGuiInput::setKeyTarget(this, true);
 }
 
 void ofxDatGuiComponent::onFocusLost()
 {
     mFocused = false;
-    mMouseDown = false;
-    ofRemoveListener(ofEvents().keyPressed, this, &ofxDatGuiComponent::onKeyPressed);
+    markDirty();
+    setMouseDown(false);
+    ofxDatGuiInput::setKeyTarget(this, false);
 }
 
 void ofxDatGuiComponent::onKeyPressed(int key) { }
@@ -563,10 +853,11 @@ void ofxDatGuiComponent::onMouseDrag(ofPoint m) { }
 
 void ofxDatGuiComponent::onKeyPressed(ofKeyEventArgs &e)
 {
+    markDirty();
     onKeyPressed(e.key);
     if ((e.key == OF_KEY_RETURN || e.key == OF_KEY_TAB)){
         onFocusLost();
-        ofRemoveListener(ofEvents().keyPressed, this, &ofxDatGuiComponent::onKeyPressed);
+        ofxDatGuiInput::setKeyTarget(this, false);
     }
 }
 
@@ -579,7 +870,7 @@ void ofxDatGuiComponent::onWindowResized()
     }
 }
 
-void ofxDatGuiComponent::onWindowResized(ofResizeEventArgs &e)
+bool ofxDatGuiComponent::onMouseScrolled(ofMouseEventArgs &e)
 {
-    onWindowResized();
+    return false;
 }
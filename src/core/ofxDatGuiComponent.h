@@ -22,6 +22,16 @@
 
 #pragma once
 #include "ofxDatGuiIntObject.h"
+#include "ofxDatGuiRenderer.h"
+#include "ofxDatGuiInput.h"
+#include "ofxDatGuiSpatialIndex.h"
+#include "ofxDatGuiRowStore.h"
+#include "ofxDatGuiEventQueue.h"
+#include "ofxDatGuiPool.h"
+#include "ofxDatGuiBatchScope.h"
+#include "ofxDatGuiProfiler.h"
+
+class ofxDatGuiLookupIndex;
 
 class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
 {
@@ -39,6 +49,10 @@ class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
         ofxDatGuiComponent(string label);
         virtual ~ofxDatGuiComponent();
     
+    // components come from the current ofxDatGuiPool when there is one, otherwise from the heap //
+        static void* operator new(size_t size);
+        static void operator delete(void* p, size_t size);
+    
         int     getX();
         int     getY();
         void    setIndex(int index);
@@ -46,6 +60,12 @@ class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
         void    setName(string name);
         string  getName();
         bool    is(string name);
+        const string& getNameKey() const { return mNameKey; }
+    
+    // names are looked up case-insensitively, see ofxDatGuiLookupIndex //
+        static string foldName(const string &name);
+    // same, into a caller owned buffer so repeated lookups reuse its capacity //
+        static void foldName(const string &name, string &folded);
     
         void    setLabel(string label);
         string  getLabel();
@@ -85,6 +105,30 @@ class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
         bool    getMouseDown();
         ofxDatGuiType getType();
     
+    // flag this component for redraw when its gui caches its rendering //
+        void    markDirty();
+        bool    isDirty(bool recursive = true);
+        void    clearDirty();
+        ofRectangle getLastDrawBounds();
+    
+    // indexed input, only the components under the mouse resolve hover & press //
+        virtual void markInputCandidate(const ofPoint & m);
+        static void beginIndexedInput();
+        static void endIndexedInput();
+    // an open popup (e.g. a color picker) under the mouse, it takes input ahead of the rows it covers //
+        static ofxDatGuiComponent* getPopupAt(const ofPoint & m);
+    
+    // record our per-frame state in row of a gui's row store, along with everything below us //
+        void    bindRow(ofxDatGuiRowStore* rows, int row);
+    
+    // when value changes reach the application, throttled components go out at most maxHz times a second //
+        void    setDelivery(ofxDatGuiDelivery policy, float maxHz = 30);
+        ofxDatGuiDelivery getDelivery();
+    // queue held back events in a gui's queue, along with everything below us //
+        void    bindEventQueue(ofxDatGuiEventQueue* queue);
+    // the gui lookup index we are in, it is told when we are renamed or destroyed //
+        void    bindLookupIndex(ofxDatGuiLookupIndex* index);
+    
         vector<ofxDatGuiComponent*> children;
     
         virtual void draw();
@@ -100,6 +144,7 @@ class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
         virtual int  getHeight();
         virtual bool getIsExpanded();
         virtual void drawColorPicker();
+        virtual ofRectangle getDrawBounds();
 
         virtual void onFocus();    
         virtual void onFocusLost();
@@ -111,21 +156,32 @@ class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
         virtual void onMouseLeave(ofPoint m);
         virtual void onMouseRelease(ofPoint m);
         void onKeyPressed(ofKeyEventArgs &e);
-        void onWindowResized(ofResizeEventArgs &e);
+    // return true to keep a scroll from reaching scroll targets below us //
+        virtual bool onMouseScrolled(ofMouseEventArgs &e);
 
         static const ofxDatGuiTheme* getTheme();
     
     protected:
     
+    // containers call this for a child added after they were attached to a gui //
+        void    adoptChild(ofxDatGuiComponent* child);
+    // the index of the gui we are attached to, nullptr while we aren't //
+        ofxDatGuiLookupIndex* getLookupIndex() { return mLookupIndex; }
+    
         int x;
         int y;
         int mIndex;
         string mName;
+        string mNameKey;
         bool mFocused;
         bool mVisible;
         bool mEnabled;
         bool mMouseOver;
         bool mMouseDown;
+        bool mDirty;
+        bool mInputCandidate;
+        ofRectangle mDrawBounds;
+        ofxDatGuiSpatialIndex mChildIndex;
 
 		// LoopyDev - Global Click Capture
 		static void clearGlobalPressOwner();
@@ -172,8 +228,10 @@ class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
             int margin;
             int rightAlignedXpos;
             ofRectangle rect;
+            const ofxSmartFont* measuredWith;
             bool forceUpperCase;
             ofxDatGuiAlignment alignment;
+            ofxDatGuiGlyphs glyphs;
         } mLabel;
     
         struct {
@@ -188,11 +246,31 @@ class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
         void drawStripe();
         void drawBackground();
         void positionLabel();
+        void resolveInput(bool acceptEvents);
         void setComponentStyle(const ofxDatGuiTheme* t);
+        void setMouseDown(bool down);
+        void setPopupOpen(bool open);
+    // components report value changes through emitEvent(), deliverEvent() fires the actual event //
+        void emitEvent();
+        virtual void deliverEvent();
     
     private:
     
         static std::unique_ptr<ofxDatGuiTheme> theme;
+        void setRowFlag(uint8_t flag, bool on, bool ownOnly);
+        ofxDatGuiRowStore* mRowStore;
+        int mRow;
+    
+        friend class ofxDatGuiEventQueue;
+        bool eventDue();
+        bool flushEvent();
+        void deliverPendingEvent();
+        ofxDatGuiEventQueue* mEventQueue;
+        ofxDatGuiLookupIndex* mLookupIndex;
+        ofxDatGuiDelivery mDelivery;
+        float mDeliveryInterval;
+        float mLastDelivery;
+        bool mEventPending;
     
 };
 
@@ -39,6 +39,15 @@ enum class ofxDatGuiGraph
     OUTLINE,
 };
 
+enum class ofxDatGuiWaveform
+{
+    SINE = 0,
+    SQUARE,
+    SAW,
+    TRIANGLE,
+    CUSTOM
+};
+
 enum class ofxDatGuiAlignment
 {
     LEFT = 1,
@@ -53,6 +62,14 @@ enum class ofxDatGuiInputType
     COLORPICKER = 3
 };
 
+enum class ofxDatGuiDelivery
+{
+    EVERY_CHANGE = 0,
+    PER_FRAME,
+    ON_RELEASE,
+    THROTTLED
+};
+
 enum class ofxDatGuiType
 {
     LABEL = 0,
@@ -77,7 +94,9 @@ enum class ofxDatGuiType
 	RADIO_GROUP,
 	CURVE_EDITOR,
 	BUTTON_BAR,
-	PANEL
+	PANEL,
+	STATS_MONITOR,
+	MULTI_PLOTTER
 };
 
 
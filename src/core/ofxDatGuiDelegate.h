@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Listener slot for one event type.
+//
+// The listener is kept in a small inline buffer: a member function bound
+// to its object, or a lambda capturing a pointer or two, never touches the
+// heap. Larger callables fall back to a heap copy. Events are handed to the
+// listener by const reference, so a listener taking the event by value
+// copies it once and one taking a const reference never does, no matter
+// how deep the component that fired it is nested.
+//
+// A delegate can also forward to the delegate of another object instead
+// of holding a listener itself (see forward()). Containers forward their
+// children to their own delegates, which forward to the gui's, so a slider
+// three folders deep reaches the gui-level listener through a few pointer
+// hops when it fires rather than through a call per folder. Forwarding is
+// resolved when the event fires, a listener set on the gui after its
+// components were added is picked up, and one set directly on a nested
+// component takes over from the forwarding. A container that goes away
+// before one of its children has to unforward() the child's delegates, and
+// a chain must never loop back on itself.
+template <typename E>
+class ofxDatGuiDelegate {
+public:
+	ofxDatGuiDelegate() = default;
+	ofxDatGuiDelegate(std::nullptr_t) { }
+
+	template <typename F, typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, ofxDatGuiDelegate>::value>::type>
+	ofxDatGuiDelegate(F && f) {
+		store(std::forward<F>(f));
+	}
+
+	ofxDatGuiDelegate(const ofxDatGuiDelegate & o) {
+		assign(o);
+	}
+
+	~ofxDatGuiDelegate() { reset(); }
+
+	ofxDatGuiDelegate & operator=(const ofxDatGuiDelegate & o) {
+		if (this != &o) {
+			reset();
+			assign(o);
+		}
+		return *this;
+	}
+
+	ofxDatGuiDelegate & operator=(std::nullptr_t) {
+		reset();
+		return *this;
+	}
+
+	template <typename F, typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, ofxDatGuiDelegate>::value>::type>
+	ofxDatGuiDelegate & operator=(F && f) {
+		reset();
+		store(std::forward<F>(f));
+		return *this;
+	}
+
+	// Call method on owner, the method may take the event by value or by const reference.
+	template <typename T, typename A, class L>
+	void bind(T * owner, void (L::*method)(A)) {
+		L * o = owner;
+		*this = [o, method](const E & e) { (o->*method)(e); };
+	}
+
+	// Resolve to whatever the other delegate resolves to when the event fires.
+	void forward(const ofxDatGuiDelegate * to) {
+		assert(to == nullptr || !to->reaches(this));
+		reset();
+		mForward = to;
+	}
+
+	// Stop forwarding if this forwards to the delegate to, which is about to go away.
+	void unforward(const ofxDatGuiDelegate * to) {
+		if (mForward == to) mForward = nullptr;
+	}
+
+	// True if this forwards to another delegate, whether or not that reaches a listener.
+	bool forwarding() const { return mForward != nullptr; }
+
+	void operator()(const E & e) const {
+		const ofxDatGuiDelegate * d = target();
+		if (d != nullptr) d->mOps->invoke(d->mBuffer, e);
+	}
+
+	// True if firing would reach a listener.
+	explicit operator bool() const { return target() != nullptr; }
+
+	friend bool operator==(const ofxDatGuiDelegate & d, std::nullptr_t) { return !d; }
+	friend bool operator!=(const ofxDatGuiDelegate & d, std::nullptr_t) { return (bool)d; }
+
+private:
+	static constexpr size_t kInline = 4 * sizeof(void *);
+
+	struct Ops {
+		void (*invoke)(void *, const E &);
+		void (*copy)(void *, const void *);
+		void (*destroy)(void *);
+	};
+
+	template <typename F>
+	struct Local {
+		static void invoke(void * p, const E & e) { (*static_cast<F *>(p))(e); }
+		static void copy(void * dst, const void * src) { new (dst) F(*static_cast<const F *>(src)); }
+		static void destroy(void * p) { static_cast<F *>(p)->~F(); }
+		static const Ops * ops() {
+			static const Ops o = { &invoke, &copy, &destroy };
+			return &o;
+		}
+	};
+
+	template <typename F>
+	struct Heap {
+		static void invoke(void * p, const E & e) { (**static_cast<F **>(p))(e); }
+		static void copy(void * dst, const void * src) { new (dst) F *(new F(**static_cast<F * const *>(src))); }
+		static void destroy(void * p) { delete *static_cast<F **>(p); }
+		static const Ops * ops() {
+			static const Ops o = { &invoke, &copy, &destroy };
+			return &o;
+		}
+	};
+
+	// an empty std::function or null function pointer leaves the delegate empty
+	template <typename F>
+	static bool isEmpty(const F &) { return false; }
+	template <typename S>
+	static bool isEmpty(const std::function<S> & f) { return !f; }
+	template <typename R, typename... A>
+	static bool isEmpty(R (*f)(A...)) { return f == nullptr; }
+
+	template <typename F>
+	void store(F && f) {
+		typedef typename std::decay<F>::type Fn;
+		if (isEmpty(f)) return;
+		emplace<Fn>(std::forward<F>(f), std::integral_constant<bool, sizeof(Fn) <= kInline && alignof(Fn) <= alignof(void *)>());
+	}
+
+	template <typename Fn, typename F>
+	void emplace(F && f, std::true_type) {
+		new (mBuffer) Fn(std::forward<F>(f));
+		mOps = Local<Fn>::ops();
+	}
+
+	template <typename Fn, typename F>
+	void emplace(F && f, std::false_type) {
+		new (mBuffer) Fn *(new Fn(std::forward<F>(f)));
+		mOps = Heap<Fn>::ops();
+	}
+
+	void assign(const ofxDatGuiDelegate & o) {
+		mForward = o.mForward;
+		if (o.mOps != nullptr) {
+			o.mOps->copy(mBuffer, o.mBuffer);
+			mOps = o.mOps;
+		}
+	}
+
+	void reset() {
+		if (mOps != nullptr) mOps->destroy(mBuffer);
+		mOps = nullptr;
+		mForward = nullptr;
+	}
+
+	bool reaches(const ofxDatGuiDelegate * d) const {
+		for (const ofxDatGuiDelegate * f = this; f != nullptr; f = f->mForward)
+			if (f == d) return true;
+		return false;
+	}
+
+	const ofxDatGuiDelegate * target() const {
+		const ofxDatGuiDelegate * d = this;
+		while (d->mForward != nullptr)
+			d = d->mForward;
+		return d->mOps != nullptr ? d : nullptr;
+	}
+
+	const Ops * mOps = nullptr;
+	const ofxDatGuiDelegate * mForward = nullptr;
+	alignas(void *) mutable unsigned char mBuffer[kInline];
+};
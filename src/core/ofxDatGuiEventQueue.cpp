@@ -0,0 +1,20 @@
+#include "ofxDatGuiEventQueue.h"
+#include "ofxDatGuiComponent.h"
+#include <algorithm>
+
+void ofxDatGuiEventQueue::remove(ofxDatGuiComponent * c) {
+	mPending.erase(std::remove(mPending.begin(), mPending.end(), c), mPending.end());
+	// a listener may delete a component while the queue is being flushed //
+	std::replace(mFlushing.begin(), mFlushing.end(), c, static_cast<ofxDatGuiComponent *>(nullptr));
+}
+
+void ofxDatGuiEventQueue::flush() {
+	if (mPending.empty()) return;
+	// listeners may change values and queue them again, those go out next frame //
+	mFlushing.swap(mPending);
+	for (size_t i = 0; i < mFlushing.size(); i++) {
+		ofxDatGuiComponent * c = mFlushing[i];
+		if (c != nullptr && !c->flushEvent()) mPending.push_back(c);
+	}
+	mFlushing.clear();
+}
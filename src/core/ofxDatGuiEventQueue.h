@@ -0,0 +1,37 @@
+#pragma once
+
+#include <vector>
+
+class ofxDatGuiComponent;
+
+// Value change events a gui holds back until the end of its update().
+//
+// A component whose delivery policy is anything but every change (see
+// ofxDatGuiComponent::setDelivery()) does not fire while it is dragged. It
+// queues itself here once and remembers that it has an event pending;
+// further changes in the same frame only update its value. When the gui
+// flushes the queue each component that is due builds its event from its
+// current value, so the application sees the latest value per component,
+// once per frame at most, in the order the components first changed.
+//
+// Components that are not due yet (held until release, or throttled and
+// delivered too recently) stay queued for the next flush. With queued
+// delivery enabled on the gui, components left at every change are held
+// back to once per frame as well.
+class ofxDatGuiEventQueue {
+public:
+	ofxDatGuiEventQueue()
+		: mQueued(false) { }
+
+	void push(ofxDatGuiComponent * c) { mPending.push_back(c); }
+	void remove(ofxDatGuiComponent * c);
+	void flush();
+
+	void setQueued(bool queued) { mQueued = queued; }
+	bool getQueued() const { return mQueued; }
+
+private:
+	std::vector<ofxDatGuiComponent *> mPending;
+	std::vector<ofxDatGuiComponent *> mFlushing;
+	bool mQueued;
+};
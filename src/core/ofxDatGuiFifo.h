@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Lock-free single producer, single consumer FIFO of plain values.
+//
+// The producer, an audio callback or worker thread, copies blocks in with
+// push(); the gui thread drains them with consume(), which hands out what
+// is queued as at most two contiguous spans straight from the ring so the
+// values can be reduced in place without copying them out first. Capacity
+// is rounded up to a power of two. When the consumer falls behind, push()
+// writes what fits and drops the rest rather than waiting.
+//
+// Exactly one thread may push and exactly one thread may consume.
+template <typename T>
+class ofxDatGuiFifo {
+public:
+	explicit ofxDatGuiFifo(size_t capacity = 4096)
+		: mRead(0)
+		, mWrite(0) {
+		size_t n = 1;
+		while (n < capacity)
+			n <<= 1;
+		mBuffer.resize(n);
+		mMask = n - 1;
+	}
+
+	ofxDatGuiFifo(const ofxDatGuiFifo &) = delete;
+	ofxDatGuiFifo & operator=(const ofxDatGuiFifo &) = delete;
+
+	// Producer side, returns how many values fit.
+	size_t push(const T * values, size_t count) {
+		const size_t w = mWrite.load(std::memory_order_relaxed);
+		const size_t r = mRead.load(std::memory_order_acquire);
+		count = std::min(count, mBuffer.size() - (w - r));
+		const size_t at = w & mMask;
+		const size_t first = std::min(count, mBuffer.size() - at);
+		std::copy(values, values + first, mBuffer.begin() + at);
+		std::copy(values + first, values + count, mBuffer.begin());
+		mWrite.store(w + count, std::memory_order_release);
+		return count;
+	}
+
+	// Consumer side, calls f(const T *, size_t) for each span of queued values.
+	template <typename F>
+	size_t consume(F && f) {
+		const size_t r = mRead.load(std::memory_order_relaxed);
+		const size_t count = mWrite.load(std::memory_order_acquire) - r;
+		if (count == 0) return 0;
+		const size_t at = r & mMask;
+		const size_t first = std::min(count, mBuffer.size() - at);
+		f(&mBuffer[at], first);
+		if (count > first) f(&mBuffer[0], count - first);
+		mRead.store(r + count, std::memory_order_release);
+		return count;
+	}
+
+	size_t capacity() const { return mBuffer.size(); }
+
+private:
+	std::vector<T> mBuffer;
+	size_t mMask;
+	// read and write positions only ever grow, their difference is the fill //
+	alignas(64) std::atomic<size_t> mRead;
+	alignas(64) std::atomic<size_t> mWrite;
+};
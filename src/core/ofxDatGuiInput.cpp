@@ -0,0 +1,156 @@
+#include "ofxDatGuiInput.h"
+#include "ofxDatGuiComponent.h"
+
+ofxDatGuiInput::ofxDatGuiInput()
+	: mButtonsDown(0)
+	, mMoved(false)
+	, mPressEvent(false)
+	, mReleaseEvent(false)
+	, mInvalid(true) {
+	ofAddListener(ofEvents().mouseMoved, this, &ofxDatGuiInput::onMouseMoved, OF_EVENT_ORDER_BEFORE_APP);
+	ofAddListener(ofEvents().mouseDragged, this, &ofxDatGuiInput::onMouseMoved, OF_EVENT_ORDER_BEFORE_APP);
+	ofAddListener(ofEvents().mousePressed, this, &ofxDatGuiInput::onMousePressed, OF_EVENT_ORDER_BEFORE_APP);
+	ofAddListener(ofEvents().mouseReleased, this, &ofxDatGuiInput::onMouseReleased, OF_EVENT_ORDER_BEFORE_APP);
+	ofAddListener(ofEvents().mouseScrolled, this, &ofxDatGuiInput::onMouseScrolled, OF_EVENT_ORDER_BEFORE_APP);
+	ofAddListener(ofEvents().keyPressed, this, &ofxDatGuiInput::onKeyPressed);
+	ofAddListener(ofEvents().windowResized, this, &ofxDatGuiInput::onWindowResized);
+}
+
+ofxDatGuiInput & ofxDatGuiInput::instance() {
+	// intentionally leaked, it has to outlive every gui and ofEvents() itself //
+	static ofxDatGuiInput * input = new ofxDatGuiInput();
+	return *input;
+}
+
+const ofxDatGuiInput::Snapshot & ofxDatGuiInput::get() {
+	ofxDatGuiInput & in = instance();
+	Snapshot & s = in.mSnapshot;
+	uint64_t f = ofGetFrameNum();
+	if (s.frame == f) return s;
+
+	const bool wasPressed = s.pressed;
+	s.frame = f;
+	s.mouse = in.mMouse;
+	// a click that went down and up within one frame still reads as pressed for that frame //
+	s.pressed = in.mButtonsDown > 0 || in.mPressEvent;
+	s.justPressed = s.pressed && (in.mPressEvent || !wasPressed);
+	s.hasInput = in.mMoved || in.mPressEvent || in.mReleaseEvent || in.mInvalid;
+
+	in.mMoved = false;
+	in.mInvalid = false;
+	in.mPressEvent = false;
+	// ...and its release is delivered on the next frame //
+	in.mReleaseEvent = s.pressed && in.mButtonsDown == 0;
+	return s;
+}
+
+void ofxDatGuiInput::invalidate() {
+	instance().mInvalid = true;
+}
+
+void ofxDatGuiInput::onMouseMoved(ofMouseEventArgs & e) {
+	mMouse = ofPoint(e.x, e.y);
+	mMoved = true;
+}
+
+void ofxDatGuiInput::onMousePressed(ofMouseEventArgs & e) {
+	mMouse = ofPoint(e.x, e.y);
+	mButtonsDown++;
+	mPressEvent = true;
+}
+
+void ofxDatGuiInput::onMouseReleased(ofMouseEventArgs & e) {
+	mMouse = ofPoint(e.x, e.y);
+	mButtonsDown = std::max(0, mButtonsDown - 1);
+	mReleaseEvent = true;
+}
+
+void ofxDatGuiInput::setKeyTarget(ofxDatGuiComponent * c, bool on) {
+	setTarget(instance().mKeyTargets, c, on, false);
+}
+
+void ofxDatGuiInput::setScrollTarget(ofxDatGuiComponent * c, bool on) {
+	setTarget(instance().mScrollTargets, c, on, false);
+}
+
+void ofxDatGuiInput::setResizeTarget(ofxDatGuiComponent * c, bool on) {
+	setTarget(instance().mResizeTargets, c, on, true);
+}
+
+void ofxDatGuiInput::remove(ofxDatGuiComponent * c) {
+	// whatever the count, a destroyed component is gone from every list //
+	ofxDatGuiInput & in = instance();
+	for (Targets * t : { &in.mKeyTargets, &in.mScrollTargets, &in.mResizeTargets }) {
+		for (auto it = t->entries.begin(); it != t->entries.end(); ++it) {
+			if (it->component == c) {
+				drop(*t, it);
+				break;
+			}
+		}
+	}
+}
+
+void ofxDatGuiInput::setTarget(Targets & targets, ofxDatGuiComponent * c, bool on, bool counted) {
+	auto it = targets.entries.begin();
+	while (it != targets.entries.end() && it->component != c)
+		++it;
+	if (on) {
+		if (it == targets.entries.end()) {
+			targets.entries.push_back({ c, 1 });
+		} else if (counted) {
+			it->refs++;
+		}
+	} else if (it != targets.entries.end()) {
+		if (counted && --it->refs > 0) return;
+		drop(targets, it);
+	}
+}
+
+void ofxDatGuiInput::drop(Targets & targets, vector<Targets::Entry>::iterator it) {
+	// erasing would shift the entries a dispatch is walking, leave a tombstone instead //
+	if (targets.dispatching > 0) {
+		it->component = nullptr;
+		targets.tombstoned = true;
+	} else {
+		targets.entries.erase(it);
+	}
+}
+
+void ofxDatGuiInput::endDispatch(Targets & targets) {
+	if (--targets.dispatching > 0 || !targets.tombstoned) return;
+	auto & v = targets.entries;
+	v.erase(std::remove_if(v.begin(), v.end(), [](const Targets::Entry & e) { return e.component == nullptr; }), v.end());
+	targets.tombstoned = false;
+}
+
+void ofxDatGuiInput::onMouseScrolled(ofMouseEventArgs & e) {
+	// targets may unregister, or be destroyed, while the event is dispatched to them //
+	mScrollTargets.dispatching++;
+	// most recently registered first, the first one that takes the scroll keeps it //
+	for (size_t i = mScrollTargets.entries.size(); i-- > 0;) {
+		ofxDatGuiComponent * c = mScrollTargets.entries[i].component;
+		if (c != nullptr && c->onMouseScrolled(e)) break;
+	}
+	endDispatch(mScrollTargets);
+}
+
+void ofxDatGuiInput::onKeyPressed(ofKeyEventArgs & e) {
+	// targets registered during the dispatch get the next key //
+	mKeyTargets.dispatching++;
+	const size_t n = mKeyTargets.entries.size();
+	for (size_t i = 0; i < n; i++) {
+		ofxDatGuiComponent * c = mKeyTargets.entries[i].component;
+		if (c != nullptr) c->onKeyPressed(e);
+	}
+	endDispatch(mKeyTargets);
+}
+
+void ofxDatGuiInput::onWindowResized(ofResizeEventArgs & e) {
+	mResizeTargets.dispatching++;
+	const size_t n = mResizeTargets.entries.size();
+	for (size_t i = 0; i < n; i++) {
+		ofxDatGuiComponent * c = mResizeTargets.entries[i].component;
+		if (c != nullptr) c->onWindowResized();
+	}
+	endDispatch(mResizeTargets);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "ofMain.h"
+
+class ofxDatGuiComponent;
+
+// Event-fed mouse state shared by every gui and component.
+//
+// Instead of every component polling ofGetMousePressed() / ofGetMouseX/Y()
+// each frame, the mouse listeners below record what happened and the first
+// caller in a frame takes a snapshot of it. When nothing arrived since the
+// previous snapshot (no move, press or release) hasInput is false and
+// components can skip hover and press resolution altogether.
+//
+// Call invalidate() when components move under a stationary mouse (layout,
+// visibility...) so hover state is resolved again on the next frame.
+//
+// Keys, scroll and window resizes come in through the same single set of
+// listeners. Components register as targets here rather than adding and
+// removing their own ofEvents() listeners as they gain and lose focus:
+// keys go to the focused components, a scroll to the topmost target under
+// the mouse that takes it, and resizes to every resize target.
+//
+// Resize targets are counted, a component that registers for more than one
+// reason (a 2d pad that is also anchored) stays registered until every one
+// of them let go. Targets that unregister while an event is dispatched to
+// their list are tombstoned and the list is compacted once it is done.
+class ofxDatGuiInput {
+public:
+	struct Snapshot {
+		ofPoint mouse;
+		bool pressed = false;
+		bool justPressed = false;
+		bool hasInput = true;
+		uint64_t frame = std::numeric_limits<uint64_t>::max();
+	};
+
+	// The input snapshot for the current frame.
+	static const Snapshot & get();
+	static void invalidate();
+
+	static void setKeyTarget(ofxDatGuiComponent * c, bool on);
+	static void setScrollTarget(ofxDatGuiComponent * c, bool on);
+	static void setResizeTarget(ofxDatGuiComponent * c, bool on);
+	// Drop c from every target list, components call this when they are destroyed.
+	static void remove(ofxDatGuiComponent * c);
+
+private:
+	ofxDatGuiInput();
+	static ofxDatGuiInput & instance();
+
+	void onMouseMoved(ofMouseEventArgs & e);
+	void onMousePressed(ofMouseEventArgs & e);
+	void onMouseReleased(ofMouseEventArgs & e);
+	void onMouseScrolled(ofMouseEventArgs & e);
+	void onKeyPressed(ofKeyEventArgs & e);
+	void onWindowResized(ofResizeEventArgs & e);
+
+	struct Targets {
+		struct Entry {
+			ofxDatGuiComponent * component;
+			int refs;
+		};
+		vector<Entry> entries;
+		int dispatching = 0;
+		bool tombstoned = false;
+	};
+
+	static void setTarget(Targets & targets, ofxDatGuiComponent * c, bool on, bool counted);
+	static void drop(Targets & targets, vector<Targets::Entry>::iterator it);
+	static void endDispatch(Targets & targets);
+
+	Targets mKeyTargets;
+	Targets mScrollTargets;
+	Targets mResizeTargets;
+
+	Snapshot mSnapshot;
+	ofPoint mMouse;
+	int mButtonsDown;
+	bool mMoved;
+	bool mPressEvent;
+	bool mReleaseEvent;
+	bool mInvalid;
+};
@@ -24,6 +24,7 @@
 #include "ofxDatGuiThemes.h"
 #include "ofxDatGuiEvents.h"
 #include "ofxDatGuiConstants.h"
+#include "ofxDatGuiDelegate.h"
 
 namespace ofxDatGuiMsg
 {
@@ -69,138 +70,156 @@ class ofxDatGuiInteractiveObject{
 
     // button events //
         typedef std::function<void(ofxDatGuiButtonEvent)> onButtonEventCallback;
-        onButtonEventCallback buttonEventCallback;
+        ofxDatGuiDelegate<ofxDatGuiButtonEvent> buttonEventCallback;
     
         template<typename T, typename args, class ListenerClass>
         void onButtonEvent(T* owner, void (ListenerClass::*listenerMethod)(args))
         {
-            buttonEventCallback = std::bind(listenerMethod, owner, std::placeholders::_1);
+            if (mInert) return;
+            buttonEventCallback.bind(owner, listenerMethod);
         }
     
         void onButtonEvent(onButtonEventCallback callback) {
+            if (mInert) return;
             buttonEventCallback = callback;
         }
     
     // toggle events //
         typedef std::function<void(ofxDatGuiToggleEvent)> onToggleEventCallback;
-        onToggleEventCallback toggleEventCallback;
+        ofxDatGuiDelegate<ofxDatGuiToggleEvent> toggleEventCallback;
     
         template<typename T, typename args, class ListenerClass>
         void onToggleEvent(T* owner, void (ListenerClass::*listenerMethod)(args))
         {
-            toggleEventCallback = std::bind(listenerMethod, owner, std::placeholders::_1);
+            if (mInert) return;
+            toggleEventCallback.bind(owner, listenerMethod);
         }
 
         void onToggleEvent(onToggleEventCallback callback) {
+            if (mInert) return;
             toggleEventCallback = callback;
         }
     
     // slider events //
         typedef std::function<void(ofxDatGuiSliderEvent)> onSliderEventCallback;
-        onSliderEventCallback sliderEventCallback;
+        ofxDatGuiDelegate<ofxDatGuiSliderEvent> sliderEventCallback;
     
         template<typename T, typename args, class ListenerClass>
         void onSliderEvent(T* owner, void (ListenerClass::*listenerMethod)(args))
         {
-            sliderEventCallback = std::bind(listenerMethod, owner, std::placeholders::_1);
+            if (mInert) return;
+            sliderEventCallback.bind(owner, listenerMethod);
         }
     
         void onSliderEvent(onSliderEventCallback callback) {
+            if (mInert) return;
             sliderEventCallback = callback;
         }
 
     // text input events //
         typedef std::function<void(ofxDatGuiTextInputEvent)> onTextInputEventCallback;
-        onTextInputEventCallback textInputEventCallback;
+        ofxDatGuiDelegate<ofxDatGuiTextInputEvent> textInputEventCallback;
     
         template<typename T, typename args, class ListenerClass>
         void onTextInputEvent(T* owner, void (ListenerClass::*listenerMethod)(args))
         {
-            textInputEventCallback = std::bind(listenerMethod, owner, std::placeholders::_1);
+            if (mInert) return;
+            textInputEventCallback.bind(owner, listenerMethod);
         }
     
         void onTextInputEvent(onTextInputEventCallback callback) {
+            if (mInert) return;
             textInputEventCallback = callback;
         }
 
     // color picker events //
         typedef std::function<void(ofxDatGuiColorPickerEvent)> onColorPickerEventCallback;
-        onColorPickerEventCallback colorPickerEventCallback;
+        ofxDatGuiDelegate<ofxDatGuiColorPickerEvent> colorPickerEventCallback;
     
         template<typename T, typename args, class ListenerClass>
         void onColorPickerEvent(T* owner, void (ListenerClass::*listenerMethod)(args))
         {
-            colorPickerEventCallback = std::bind(listenerMethod, owner, std::placeholders::_1);
+            if (mInert) return;
+            colorPickerEventCallback.bind(owner, listenerMethod);
         }
     
         void onColorPickerEvent(onColorPickerEventCallback callback) {
+            if (mInert) return;
             colorPickerEventCallback = callback;
         }
     
     // dropdown events //
         typedef std::function<void(ofxDatGuiDropdownEvent)> onDropdownEventCallback;
-        onDropdownEventCallback dropdownEventCallback;
+        ofxDatGuiDelegate<ofxDatGuiDropdownEvent> dropdownEventCallback;
     
         template<typename T, typename args, class ListenerClass>
         void onDropdownEvent(T* owner, void (ListenerClass::*listenerMethod)(args))
         {
-            dropdownEventCallback = std::bind(listenerMethod, owner, std::placeholders::_1);
+            if (mInert) return;
+            dropdownEventCallback.bind(owner, listenerMethod);
         }
     
         void onDropdownEvent(onDropdownEventCallback callback) {
+            if (mInert) return;
             dropdownEventCallback = callback;
         }
 
     // 2d pad events //
         typedef std::function<void(ofxDatGui2dPadEvent)> on2dPadEventCallback;
-        on2dPadEventCallback pad2dEventCallback;
+        ofxDatGuiDelegate<ofxDatGui2dPadEvent> pad2dEventCallback;
     
         template<typename T, typename args, class ListenerClass>
         void on2dPadEvent(T* owner, void (ListenerClass::*listenerMethod)(args))
         {
-            pad2dEventCallback = std::bind(listenerMethod, owner, std::placeholders::_1);
+            if (mInert) return;
+            pad2dEventCallback.bind(owner, listenerMethod);
         }
     
         void on2dPadEvent(on2dPadEventCallback callback) {
+            if (mInert) return;
             pad2dEventCallback = callback;
         }
 
     // matrix events //
         typedef std::function<void(ofxDatGuiMatrixEvent)> onMatrixEventCallback;
-        onMatrixEventCallback matrixEventCallback;
+        ofxDatGuiDelegate<ofxDatGuiMatrixEvent> matrixEventCallback;
     
         template<typename T, typename args, class ListenerClass>
         void onMatrixEvent(T* owner, void (ListenerClass::*listenerMethod)(args))
         {
-            matrixEventCallback = std::bind(listenerMethod, owner, std::placeholders::_1);
+            if (mInert) return;
+            matrixEventCallback.bind(owner, listenerMethod);
         }
     
         void onMatrixEvent(onMatrixEventCallback callback) {
+            if (mInert) return;
             matrixEventCallback = callback;
         }
 
     // scrollview events //
         typedef std::function<void(ofxDatGuiScrollViewEvent)> onScrollViewEventCallback;
-        onScrollViewEventCallback scrollViewEventCallback;
+        ofxDatGuiDelegate<ofxDatGuiScrollViewEvent> scrollViewEventCallback;
     
         template<typename T, typename args, class ListenerClass>
         void onScrollViewEvent(T* owner, void (ListenerClass::*listenerMethod)(args))
         {
-            scrollViewEventCallback = std::bind(listenerMethod, owner, std::placeholders::_1);
+            if (mInert) return;
+            scrollViewEventCallback.bind(owner, listenerMethod);
         }
 
         void onScrollViewEvent(onScrollViewEventCallback callback) {
+            if (mInert) return;
             scrollViewEventCallback = callback;
         }
 
     // internal events //
         typedef std::function<void(ofxDatGuiInternalEvent)> onInternalEventCallback;
-        onInternalEventCallback internalEventCallback;
+        ofxDatGuiDelegate<ofxDatGuiInternalEvent> internalEventCallback;
         
         template<typename T, typename args, class ListenerClass>
         void onInternalEvent(T* owner, void (ListenerClass::*listenerMethod)(args))
         {
-            internalEventCallback = std::bind(listenerMethod, owner, std::placeholders::_1);
+            internalEventCallback.bind(owner, listenerMethod);
         }
 
         void onInternalEvent(onInternalEventCallback callback) {
@@ -210,27 +229,88 @@ class ofxDatGuiInteractiveObject{
 		// LoopyDev's Additions
 	// cubic-bezier events //
 		typedef std::function<void(ofxDatGuiCubicBezierEvent)> onCubicBezierEventCallback;
-		onCubicBezierEventCallback cubicBezierEventCallback;
+		ofxDatGuiDelegate<ofxDatGuiCubicBezierEvent> cubicBezierEventCallback;
 
 		template <typename T, typename args, class ListenerClass>
 		void onCubicBezierEvent(T * owner, void (ListenerClass::*listenerMethod)(args)) {
-			cubicBezierEventCallback = std::bind(listenerMethod, owner, std::placeholders::_1);
+			if (mInert) return;
+			cubicBezierEventCallback.bind(owner, listenerMethod);
 		}
 
 		void onCubicBezierEvent(onCubicBezierEventCallback callback) {
+			if (mInert) return;
 			cubicBezierEventCallback = callback;
 		}
 	// Curve Editor events //
 		typedef std::function<void(ofxDatGuiCurveEditorEvent)> onCurveEditorEventCallback;
-		onCurveEditorEventCallback curveEditorEventCallback;
+		ofxDatGuiDelegate<ofxDatGuiCurveEditorEvent> curveEditorEventCallback;
 
 		template <typename T, typename args, class ListenerClass>
 		void onCurveEditorEvent(T * owner, void (ListenerClass::*listenerMethod)(args)) {
-			curveEditorEventCallback = std::bind(listenerMethod, owner, std::placeholders::_1);
+			if (mInert) return;
+			curveEditorEventCallback.bind(owner, listenerMethod);
 		}
 
 		void onCurveEditorEvent(onCurveEditorEventCallback callback) {
+			if (mInert) return;
 			curveEditorEventCallback = callback;
 		}
+	// Radio group events //
+		typedef std::function<void(ofxDatGuiRadioGroupEvent)> onRadioGroupEventCallback;
+		ofxDatGuiDelegate<ofxDatGuiRadioGroupEvent> radioGroupEventCallback;
+
+		template <typename T, typename args, class ListenerClass>
+		void onRadioGroupEvent(T * owner, void (ListenerClass::*listenerMethod)(args)) {
+			if (mInert) return;
+			radioGroupEventCallback.bind(owner, listenerMethod);
+		}
+
+		void onRadioGroupEvent(onRadioGroupEventCallback callback) {
+			if (mInert) return;
+			radioGroupEventCallback = callback;
+		}
+
+    // route every application facing event to the listeners of another object //
+    // internal events are left alone, containers handle those themselves //
+        void forwardEvents(const ofxDatGuiInteractiveObject* to)
+        {
+            if (mInert) return;
+            buttonEventCallback.forward(&to->buttonEventCallback);
+            toggleEventCallback.forward(&to->toggleEventCallback);
+            sliderEventCallback.forward(&to->sliderEventCallback);
+            textInputEventCallback.forward(&to->textInputEventCallback);
+            colorPickerEventCallback.forward(&to->colorPickerEventCallback);
+            dropdownEventCallback.forward(&to->dropdownEventCallback);
+            pad2dEventCallback.forward(&to->pad2dEventCallback);
+            matrixEventCallback.forward(&to->matrixEventCallback);
+            scrollViewEventCallback.forward(&to->scrollViewEventCallback);
+            cubicBezierEventCallback.forward(&to->cubicBezierEventCallback);
+            curveEditorEventCallback.forward(&to->curveEditorEventCallback);
+            radioGroupEventCallback.forward(&to->radioGroupEventCallback);
+        }
+    
+    // undo forwardEvents(from), for a child that outlives the container it was forwarding to //
+        void unforwardEvents(const ofxDatGuiInteractiveObject* from)
+        {
+            buttonEventCallback.unforward(&from->buttonEventCallback);
+            toggleEventCallback.unforward(&from->toggleEventCallback);
+            sliderEventCallback.unforward(&from->sliderEventCallback);
+            textInputEventCallback.unforward(&from->textInputEventCallback);
+            colorPickerEventCallback.unforward(&from->colorPickerEventCallback);
+            dropdownEventCallback.unforward(&from->dropdownEventCallback);
+            pad2dEventCallback.unforward(&from->pad2dEventCallback);
+            matrixEventCallback.unforward(&from->matrixEventCallback);
+            scrollViewEventCallback.unforward(&from->scrollViewEventCallback);
+            cubicBezierEventCallback.unforward(&from->cubicBezierEventCallback);
+            curveEditorEventCallback.unforward(&from->curveEditorEventCallback);
+            radioGroupEventCallback.unforward(&from->radioGroupEventCallback);
+        }
+
+    // the null object ofxDatGui::get*() hands out on a miss, listeners, binds and values set on it are dropped //
+        void makeInert() { mInert = true; }
+        bool isInert() const { return mInert; }
+
+    protected:
+        bool mInert = false;
 };
 
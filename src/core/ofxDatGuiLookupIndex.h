@@ -0,0 +1,163 @@
+#pragma once
+
+#include "ofxDatGuiComponent.h"
+#include <algorithm>
+#include <unordered_map>
+
+// Hashed component lookup for a gui.
+//
+// Every component below the roots, at any nesting depth, is indexed by
+// (type, case-folded name) and by (parent, case-folded name). The second
+// table resolves slash separated paths such as "Render/Bloom/Threshold"
+// one segment at a time.
+//
+// The index belongs to one gui and is kept up to date entry by entry: the
+// gui inserts its items as they are attached, containers insert children
+// they add later (see ofxDatGuiComponent::adoptChild()) and components
+// re-key themselves when renamed and erase themselves when destroyed.
+// When several components share a name the one added first is found, a
+// renamed component keeps its place among those sharing its new name.
+class ofxDatGuiLookupIndex {
+public:
+	ofxDatGuiLookupIndex() { }
+
+	~ofxDatGuiLookupIndex() {
+		// components that outlive the gui must not call back into it
+		for (auto & p : mParentOf)
+			p.first->bindLookupIndex(nullptr);
+	}
+
+	ofxDatGuiLookupIndex(const ofxDatGuiLookupIndex &) = delete;
+	ofxDatGuiLookupIndex & operator=(const ofxDatGuiLookupIndex &) = delete;
+
+	// First component of the given type named key.
+	// A key containing '/' is tried as a path first.
+	ofxDatGuiComponent * find(ofxDatGuiType type, const string & key) {
+		if (key.find('/') != string::npos) {
+			ofxDatGuiComponent * c = findPath(type, key);
+			if (c != nullptr) return c;
+		}
+		// fold into a reused key, a lookup (hit or miss) doesn't allocate
+		mProbe.type = type;
+		ofxDatGuiComponent::foldName(key, mProbe.name);
+		auto it = mByName.find(mProbe);
+		return it != mByName.end() ? it->second.front() : nullptr;
+	}
+
+	// Direct child of parent (nullptr for the gui itself) with the given type and name.
+	ofxDatGuiComponent * findChild(const ofxDatGuiComponent * parent, ofxDatGuiType type, const string & name) {
+		ofxDatGuiComponent::foldName(name, mProbe.name);
+		return child(parent, mProbe.name, &type);
+	}
+
+	// Index c and everything below it, parent is nullptr for a gui's own items.
+	void insert(const ofxDatGuiComponent * parent, ofxDatGuiComponent * c) {
+		if (!mParentOf.emplace(c, Entry { parent, mNextOrder++ }).second) return;
+		mByName[NameKey { c->getType(), c->getNameKey() }].push_back(c);
+		mByParent[ChildKey { parent, c->getNameKey() }].push_back(c);
+		c->bindLookupIndex(this);
+		for (auto child : c->children)
+			insert(c, child);
+	}
+
+	// Drop c alone, its children erase themselves when they are destroyed.
+	void erase(ofxDatGuiComponent * c) {
+		auto it = mParentOf.find(c);
+		if (it == mParentOf.end()) return;
+		unlink(it->second.parent, c, c->getNameKey());
+		mParentOf.erase(it);
+		c->bindLookupIndex(nullptr);
+	}
+
+	// c was renamed, move it from its old key to its current one.
+	void rename(ofxDatGuiComponent * c, const string & oldKey) {
+		auto it = mParentOf.find(c);
+		if (it == mParentOf.end()) return;
+		unlink(it->second.parent, c, oldKey);
+		place(mByName[NameKey { c->getType(), c->getNameKey() }], c);
+		place(mByParent[ChildKey { it->second.parent, c->getNameKey() }], c);
+	}
+
+private:
+	struct Entry {
+		const ofxDatGuiComponent * parent;
+		uint64_t order;
+	};
+
+	struct NameKey {
+		ofxDatGuiType type;
+		string name;
+		bool operator==(const NameKey & o) const { return type == o.type && name == o.name; }
+	};
+
+	struct ChildKey {
+		const ofxDatGuiComponent * parent;
+		string name;
+		bool operator==(const ChildKey & o) const { return parent == o.parent && name == o.name; }
+	};
+
+	struct Hash {
+		size_t operator()(const NameKey & k) const {
+			return std::hash<string>()(k.name) ^ ((size_t)k.type * 0x9e3779b9u);
+		}
+		size_t operator()(const ChildKey & k) const {
+			return std::hash<string>()(k.name) ^ std::hash<const void *>()(k.parent);
+		}
+	};
+
+	template <typename Map, typename Key>
+	static void drop(Map & map, const Key & key, ofxDatGuiComponent * c) {
+		auto it = map.find(key);
+		if (it == map.end()) return;
+		auto & v = it->second;
+		v.erase(std::remove(v.begin(), v.end(), c), v.end());
+		if (v.empty()) map.erase(it);
+	}
+
+	// insert c in the order the components were added, not at the back
+	void place(vector<ofxDatGuiComponent *> & v, ofxDatGuiComponent * c) {
+		const uint64_t order = mParentOf[c].order;
+		auto at = std::upper_bound(v.begin(), v.end(), order, [this](uint64_t o, ofxDatGuiComponent * e) { return o < mParentOf[e].order; });
+		v.insert(at, c);
+	}
+
+	void unlink(const ofxDatGuiComponent * parent, ofxDatGuiComponent * c, const string & key) {
+		mProbe.type = c->getType();
+		mProbe.name.assign(key);
+		drop(mByName, mProbe, c);
+		mChildProbe.parent = parent;
+		mChildProbe.name.assign(key);
+		drop(mByParent, mChildProbe, c);
+	}
+
+	// type == nullptr matches any type (intermediate path segments)
+	ofxDatGuiComponent * child(const ofxDatGuiComponent * parent, const string & folded, const ofxDatGuiType * type) {
+		mChildProbe.parent = parent;
+		mChildProbe.name.assign(folded);
+		auto it = mByParent.find(mChildProbe);
+		if (it == mByParent.end()) return nullptr;
+		for (auto c : it->second) {
+			if (type == nullptr || c->getType() == *type) return c;
+		}
+		return nullptr;
+	}
+
+	ofxDatGuiComponent * findPath(ofxDatGuiType type, const string & path) {
+		vector<string> segments = ofSplitString(ofxDatGuiComponent::foldName(path), "/", true, true);
+		const ofxDatGuiComponent * parent = nullptr;
+		for (size_t i = 0; i < segments.size(); i++) {
+			const bool last = i == segments.size() - 1;
+			ofxDatGuiComponent * c = child(parent, segments[i], last ? &type : nullptr);
+			if (c == nullptr || last) return c;
+			parent = c;
+		}
+		return nullptr;
+	}
+
+	std::unordered_map<NameKey, vector<ofxDatGuiComponent *>, Hash> mByName;
+	std::unordered_map<ChildKey, vector<ofxDatGuiComponent *>, Hash> mByParent;
+	std::unordered_map<ofxDatGuiComponent *, Entry> mParentOf;
+	uint64_t mNextOrder = 0;
+	NameKey mProbe;
+	ChildKey mChildProbe;
+};
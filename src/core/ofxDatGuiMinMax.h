@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cfloat>
+#include <cstddef>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define OFX_DATGUI_MINMAX_SSE 1
+#endif
+
+// Widen lo / hi to cover the values in [v, v + n).
+//
+// The plotters reduce thousands of samples per pixel column to the
+// column's extremes, so a spike between two frames still shows up as a
+// full height band. With SSE four lanes are compared per instruction and
+// the lanes are folded at the end, anything else takes the scalar loop,
+// which is also what handles the tail. NaNs are not filtered.
+inline void ofxDatGuiMinMax(const float * v, size_t n, float & lo, float & hi) {
+	size_t i = 0;
+#ifdef OFX_DATGUI_MINMAX_SSE
+	if (n >= 8) {
+		__m128 mn = _mm_set1_ps(lo);
+		__m128 mx = _mm_set1_ps(hi);
+		for (; i + 4 <= n; i += 4) {
+			const __m128 x = _mm_loadu_ps(v + i);
+			mn = _mm_min_ps(mn, x);
+			mx = _mm_max_ps(mx, x);
+		}
+		mn = _mm_min_ps(mn, _mm_movehl_ps(mn, mn));
+		mx = _mm_max_ps(mx, _mm_movehl_ps(mx, mx));
+		mn = _mm_min_ss(mn, _mm_shuffle_ps(mn, mn, 1));
+		mx = _mm_max_ss(mx, _mm_shuffle_ps(mx, mx, 1));
+		lo = _mm_cvtss_f32(mn);
+		hi = _mm_cvtss_f32(mx);
+	}
+#endif
+	for (; i < n; i++) {
+		if (v[i] < lo) lo = v[i];
+		if (v[i] > hi) hi = v[i];
+	}
+}
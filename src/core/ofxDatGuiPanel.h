@@ -148,7 +148,7 @@ public:
 	void draw() override {
 		if (!mVisible) return;
 
-		ofPushStyle();
+		ofxDatGuiRenderState::push();
 		// Panel itself stays visually transparent by default.
 		// If you ever want a framed block, uncomment:
 		// drawBackground();
@@ -158,6 +158,7 @@ public:
 			if (!c->getVisible()) continue;
 
 			// Let the child draw itself first
+			OFX_DATGUI_PROFILE_COMPONENT(c, DRAW);
 			c->draw();
 
 			// In horizontal mode, draw a bottom stripe for each child,
@@ -167,7 +168,7 @@ public:
 			}
 		}
 
-		ofPopStyle();
+		ofxDatGuiRenderState::pop();
 	}
 
 	// ---------------------------------------------------------------------
@@ -191,6 +192,7 @@ public:
 
 		item->onInternalEvent(this, &ofxDatGuiPanel::onInternalChildEvent);
 		children.push_back(item);
+		adoptChild(item);
 		layout();
 	}
 
@@ -288,8 +290,10 @@ protected:
 
 	// Internal events coming from children (visibility changes, etc.).
 	void onInternalChildEvent(ofxDatGuiInternalEvent e) {
-		if (e.type == ofxDatGuiEventType::VISIBILITY_CHANGED) {
+		if (e.type == ofxDatGuiEventType::VISIBILITY_CHANGED || e.type == ofxDatGuiEventType::GROUP_TOGGLED) {
 			layout();
+			// report the change at our own index, that's where the parent has to resume layout
+			e = ofxDatGuiInternalEvent(e.type, mIndex);
 		}
 
 		// Bubble the event up if someone is listening to this panel.
@@ -313,8 +317,7 @@ protected:
 
 		if (sw <= 0.f) return;
 
-		ofSetColor(child->getStripeColor()); // <-- use child color
-		ofDrawRectangle(sx, sy, sw, stripeH);
+		ofxDatGuiRenderer::rect(sx, sy, sw, stripeH, child->getStripeColor()); // <-- use child color
 	}
 
 
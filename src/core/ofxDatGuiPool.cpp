@@ -0,0 +1,84 @@
+#include "ofxDatGuiPool.h"
+#include <algorithm>
+#include <new>
+
+const std::shared_ptr<ofxDatGuiPool> * ofxDatGuiPool::sCurrent = nullptr;
+
+ofxDatGuiPool::ofxDatGuiPool(size_t chunkSize)
+	: mChunkSize(blockSize(chunkSize))
+	, mCursor(nullptr)
+	, mRemaining(0)
+	, mInUse(0)
+	, mReserved(0)
+	, mDraining(0) { }
+
+ofxDatGuiPool::~ofxDatGuiPool() {
+	purge();
+}
+
+std::shared_ptr<ofxDatGuiPool> ofxDatGuiPool::current() {
+	return sCurrent != nullptr ? *sCurrent : std::shared_ptr<ofxDatGuiPool>();
+}
+
+size_t ofxDatGuiPool::blockSize(size_t size) {
+	return (size + kGranularity - 1) / kGranularity * kGranularity;
+}
+
+void * ofxDatGuiPool::allocate(size_t size) {
+	const size_t bytes = sizeof(Header) + blockSize(size);
+	ofxDatGuiPool * pool = sCurrent != nullptr ? sCurrent->get() : nullptr;
+	void * block = pool != nullptr ? pool->take(bytes) : ::operator new(bytes);
+	Header * h = new (block) Header{ pool };
+	return h + 1;
+}
+
+void ofxDatGuiPool::release(void * p, size_t size) {
+	if (p == nullptr) return;
+	Header * h = static_cast<Header *>(p) - 1;
+	if (h->pool != nullptr) {
+		h->pool->give(h, sizeof(Header) + blockSize(size));
+	} else {
+		::operator delete(h);
+	}
+}
+
+void * ofxDatGuiPool::take(size_t bytes) {
+	mInUse += bytes;
+	const size_t cls = bytes / kGranularity;
+	if (cls < mFree.size() && !mFree[cls].empty()) {
+		void * block = mFree[cls].back();
+		mFree[cls].pop_back();
+		return block;
+	}
+	if (bytes > mRemaining) {
+		// the tail of the previous chunk is simply abandoned //
+		const size_t size = std::max(mChunkSize, bytes);
+		mCursor = static_cast<char *>(::operator new(size));
+		mChunks.push_back(mCursor);
+		mRemaining = size;
+		mReserved += size;
+	}
+	void * block = mCursor;
+	mCursor += bytes;
+	mRemaining -= bytes;
+	return block;
+}
+
+void ofxDatGuiPool::give(void * block, size_t bytes) {
+	mInUse -= bytes;
+	// the whole pool is about to be purged //
+	if (mDraining > 0) return;
+	const size_t cls = bytes / kGranularity;
+	if (cls >= mFree.size()) mFree.resize(cls + 1);
+	mFree[cls].push_back(block);
+}
+
+void ofxDatGuiPool::purge() {
+	for (auto c : mChunks)
+		::operator delete(c);
+	mChunks.clear();
+	mFree.clear();
+	mCursor = nullptr;
+	mRemaining = 0;
+	mReserved = 0;
+}
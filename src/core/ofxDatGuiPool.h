@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Size-class pool that components can be allocated from.
+//
+// Memory is carved out of large chunks with a bump pointer. A released
+// component goes onto a free list for its size class and is handed out
+// again to the next component of the same size, so a gui that is torn
+// down and rebuilt on the same pool reuses the blocks of the previous one.
+// The chunks themselves are only returned to the system when the pool
+// goes away, all at once.
+//
+// Components are allocated from whatever pool a Scope made current (see
+// ofxDatGui::setAllocator()), or from the heap when there is none. Each
+// block remembers its pool with a plain pointer, so the pool has to outlive
+// the components allocated from it; a gui keeps every pool it allocated
+// from alive until it has deleted its components.
+//
+// While a Teardown is open blocks aren't put back on the free lists, and
+// once the pool has no blocks in use any more its chunks are freed in one
+// go. A pool shared by several guis only gets the blocks of a torn down
+// gui back that way when the last of them goes.
+class ofxDatGuiPool {
+public:
+	explicit ofxDatGuiPool(size_t chunkSize = 64 * 1024);
+	~ofxDatGuiPool();
+
+	ofxDatGuiPool(const ofxDatGuiPool &) = delete;
+	ofxDatGuiPool & operator=(const ofxDatGuiPool &) = delete;
+
+	// Make pool current for the lifetime of the scope, a null pool means the heap.
+	class Scope {
+	public:
+		explicit Scope(const std::shared_ptr<ofxDatGuiPool> & pool)
+			: mPrevious(sCurrent) {
+			sCurrent = pool ? &pool : nullptr;
+		}
+		~Scope() { sCurrent = mPrevious; }
+
+	private:
+		const std::shared_ptr<ofxDatGuiPool> * mPrevious;
+	};
+
+	// Delete the components of a gui without recycling their blocks one by one.
+	class Teardown {
+	public:
+		explicit Teardown(ofxDatGuiPool * pool)
+			: mPool(pool) {
+			if (mPool != nullptr) mPool->mDraining++;
+		}
+		~Teardown() {
+			if (mPool != nullptr && --mPool->mDraining == 0 && mPool->mInUse == 0) mPool->purge();
+		}
+
+	private:
+		ofxDatGuiPool * mPool;
+	};
+
+	// The current pool, or an empty pointer.
+	static std::shared_ptr<ofxDatGuiPool> current();
+
+	// Backing for ofxDatGuiComponent::operator new / delete.
+	static void * allocate(size_t size);
+	static void release(void * p, size_t size);
+
+	// Bytes handed out to live blocks and bytes reserved in chunks.
+	size_t getBytesInUse() const { return mInUse; }
+	size_t getBytesReserved() const { return mReserved; }
+
+private:
+	struct alignas(std::max_align_t) Header {
+		ofxDatGuiPool * pool;
+	};
+
+	static constexpr size_t kGranularity = alignof(std::max_align_t);
+	static size_t blockSize(size_t size);
+
+	void * take(size_t bytes);
+	void give(void * block, size_t bytes);
+	void purge();
+
+	size_t mChunkSize;
+	std::vector<char *> mChunks;
+	char * mCursor;
+	size_t mRemaining;
+	std::vector<std::vector<void *>> mFree;
+	size_t mInUse;
+	size_t mReserved;
+	int mDraining;
+
+	static const std::shared_ptr<ofxDatGuiPool> * sCurrent;
+};
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "ofxDatGuiConstants.h"
+#include <chrono>
+#include <map>
+#include <unordered_map>
+
+// Optional timing instrumentation, compiled in only when the addon is built
+// with OFX_DATGUI_PROFILE defined. Without it the macros below expand to
+// nothing and ofxDatGui::getStats() stays empty.
+//
+// Every gui owns an ofxDatGuiStats. Its update() and draw() passes are timed
+// as a whole, and each component is timed where its parent (the gui, a group
+// or a panel) updates or draws it. Component times are exclusive: a folder
+// only accounts for its own header, the time spent in its children goes to
+// their types. With batch rendering the actual draw call happens when the
+// batch is flushed, so that cost shows up in the gui's draw time only.
+
+class ofxDatGuiComponent;
+
+struct ofxDatGuiTiming {
+	uint64_t calls = 0;
+	double total = 0; // microseconds since the last reset
+	double peak = 0; // longest single call
+
+	void add(double us) {
+		calls++;
+		total += us;
+		if (us > peak) peak = us;
+	}
+	double perCall() const { return calls > 0 ? total / calls : 0; }
+};
+
+struct ofxDatGuiPhaseTiming {
+	ofxDatGuiTiming update;
+	ofxDatGuiTiming draw;
+};
+
+struct ofxDatGuiStats {
+	// number of update passes since the last reset, total / frames is the per frame cost
+	uint64_t frames = 0;
+	ofxDatGuiPhaseTiming gui;
+	std::map<ofxDatGuiType, ofxDatGuiPhaseTiming> types;
+	// only filled while instance tracking is enabled (ofxDatGui::setProfileInstances)
+	std::unordered_map<const ofxDatGuiComponent *, ofxDatGuiPhaseTiming> instances;
+	bool trackInstances = false;
+
+	void reset() {
+		frames = 0;
+		gui = ofxDatGuiPhaseTiming();
+		types.clear();
+		instances.clear();
+	}
+};
+
+inline const char * ofxDatGuiTypeName(ofxDatGuiType type) {
+	switch (type) {
+	case ofxDatGuiType::LABEL: return "LABEL";
+	case ofxDatGuiType::BREAK: return "BREAK";
+	case ofxDatGuiType::BUTTON: return "BUTTON";
+	case ofxDatGuiType::TOGGLE: return "TOGGLE";
+	case ofxDatGuiType::PAD2D: return "2D PAD";
+	case ofxDatGuiType::HEADER: return "HEADER";
+	case ofxDatGuiType::FOOTER: return "FOOTER";
+	case ofxDatGuiType::MATRIX: return "MATRIX";
+	case ofxDatGuiType::SLIDER: return "SLIDER";
+	case ofxDatGuiType::FOLDER: return "FOLDER";
+	case ofxDatGuiType::DROPDOWN: return "DROPDOWN";
+	case ofxDatGuiType::DROPDOWN_OPTION: return "DROPDOWN OPTION";
+	case ofxDatGuiType::TEXT_INPUT: return "TEXT INPUT";
+	case ofxDatGuiType::FRAME_RATE: return "FRAME RATE";
+	case ofxDatGuiType::COLOR_PICKER: return "COLOR PICKER";
+	case ofxDatGuiType::WAVE_MONITOR: return "WAVE MONITOR";
+	case ofxDatGuiType::VALUE_PLOTTER: return "VALUE PLOTTER";
+	case ofxDatGuiType::CUBIC_BEZIER: return "CUBIC BEZIER";
+	case ofxDatGuiType::RADIO_GROUP: return "RADIO GROUP";
+	case ofxDatGuiType::CURVE_EDITOR: return "CURVE EDITOR";
+	case ofxDatGuiType::BUTTON_BAR: return "BUTTON BAR";
+	case ofxDatGuiType::PANEL: return "PANEL";
+	case ofxDatGuiType::STATS_MONITOR: return "STATS MONITOR";
+	case ofxDatGuiType::MULTI_PLOTTER: return "MULTI PLOTTER";
+	}
+	return "UNKNOWN";
+}
+
+#ifdef OFX_DATGUI_PROFILE
+
+class ofxDatGuiProfiler {
+	typedef std::chrono::steady_clock Clock;
+
+public:
+	enum Phase {
+		UPDATE,
+		DRAW
+	};
+
+	// Times a whole gui pass and routes nested component timings to its stats.
+	class GuiScope {
+	public:
+		GuiScope(ofxDatGuiStats & stats, Phase phase)
+			: mStats(stats)
+			, mPhase(phase)
+			, mPrevious(sActive)
+			, mStart(Clock::now()) {
+			sActive = &mStats;
+		}
+		~GuiScope() {
+			double us = elapsed(mStart);
+			sActive = mPrevious;
+			if (mPhase == UPDATE) {
+				mStats.frames++;
+				mStats.gui.update.add(us);
+			} else {
+				mStats.gui.draw.add(us);
+			}
+		}
+
+	private:
+		ofxDatGuiStats & mStats;
+		Phase mPhase;
+		ofxDatGuiStats * mPrevious;
+		Clock::time_point mStart;
+	};
+
+	// Times one component, minus whatever its nested component scopes took.
+	class ComponentScope {
+	public:
+		ComponentScope(const ofxDatGuiComponent * c, ofxDatGuiType type, Phase phase)
+			: mComponent(c)
+			, mType(type)
+			, mPhase(phase)
+			, mChildren(0)
+			, mParent(sScope)
+			, mStart(Clock::now()) {
+			sScope = this;
+		}
+		~ComponentScope() {
+			double us = elapsed(mStart);
+			sScope = mParent;
+			if (mParent != nullptr) mParent->mChildren += us;
+			if (sActive == nullptr) return;
+			double self = us - mChildren;
+			ofxDatGuiPhaseTiming & t = sActive->types[mType];
+			(mPhase == UPDATE ? t.update : t.draw).add(self);
+			if (sActive->trackInstances) {
+				ofxDatGuiPhaseTiming & i = sActive->instances[mComponent];
+				(mPhase == UPDATE ? i.update : i.draw).add(self);
+			}
+		}
+
+	private:
+		const ofxDatGuiComponent * mComponent;
+		ofxDatGuiType mType;
+		Phase mPhase;
+		double mChildren;
+		ComponentScope * mParent;
+		Clock::time_point mStart;
+	};
+
+private:
+	static double elapsed(Clock::time_point start) {
+		return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+	}
+
+	static ofxDatGuiStats * sActive;
+	static ComponentScope * sScope;
+};
+
+	#define OFX_DATGUI_PROFILE_GUI(stats, phase) ofxDatGuiProfiler::GuiScope ofxDatGuiProfileGui_(stats, ofxDatGuiProfiler::phase)
+	#define OFX_DATGUI_PROFILE_COMPONENT(c, phase) ofxDatGuiProfiler::ComponentScope ofxDatGuiProfileComponent_(c, (c)->getType(), ofxDatGuiProfiler::phase)
+#else
+	#define OFX_DATGUI_PROFILE_GUI(stats, phase)
+	#define OFX_DATGUI_PROFILE_COMPONENT(c, phase)
+#endif
@@ -0,0 +1,125 @@
+#include "ofxDatGuiRenderState.h"
+
+ofxDatGuiRenderState::State ofxDatGuiRenderState::sState;
+vector<ofxDatGuiRenderState::State> ofxDatGuiRenderState::sStack;
+vector<float> ofxDatGuiRenderState::sUntrackedPointSizes;
+float ofxDatGuiRenderState::sPointSize = 1;
+int ofxDatGuiRenderState::sDepth = 0;
+ofxDatGuiRenderState::Counters ofxDatGuiRenderState::sCounters;
+
+void ofxDatGuiRenderState::begin() {
+	if (sDepth++ == 0) invalidate();
+}
+
+void ofxDatGuiRenderState::end() {
+	if (sDepth == 0) return;
+	if (--sDepth == 0) sStack.clear();
+}
+
+void ofxDatGuiRenderState::invalidate() {
+	const ofStyle & style = ofGetStyle();
+	sState.color = style.color;
+	sState.filled = style.bFill;
+	sState.lineWidth = style.lineWidth;
+	sState.pointSize = sPointSize;
+}
+
+void ofxDatGuiRenderState::setColor(const ofColor & color) {
+	if (sDepth == 0) {
+		ofSetColor(color);
+	} else if (sState.color != color) {
+		sState.color = color;
+		ofSetColor(color);
+		sCounters.issued++;
+	} else {
+		sCounters.skipped++;
+	}
+}
+
+void ofxDatGuiRenderState::fill() {
+	if (sDepth == 0) {
+		ofFill();
+	} else if (!sState.filled) {
+		sState.filled = true;
+		ofFill();
+		sCounters.issued++;
+	} else {
+		sCounters.skipped++;
+	}
+}
+
+void ofxDatGuiRenderState::noFill() {
+	if (sDepth == 0) {
+		ofNoFill();
+	} else if (sState.filled) {
+		sState.filled = false;
+		ofNoFill();
+		sCounters.issued++;
+	} else {
+		sCounters.skipped++;
+	}
+}
+
+void ofxDatGuiRenderState::setLineWidth(float width) {
+	if (sDepth == 0) {
+		ofSetLineWidth(width);
+	} else if (sState.lineWidth != width) {
+		sState.lineWidth = width;
+		ofSetLineWidth(width);
+		sCounters.issued++;
+	} else {
+		sCounters.skipped++;
+	}
+}
+
+void ofxDatGuiRenderState::setPointSize(float size) {
+	if (sDepth == 0) {
+		if (sPointSize != size) glPointSize(size);
+		sPointSize = size;
+	} else if (sState.pointSize != size) {
+		sState.pointSize = size;
+		sPointSize = size;
+		glPointSize(size);
+		sCounters.issued++;
+	} else {
+		sCounters.skipped++;
+	}
+}
+
+void ofxDatGuiRenderState::push() {
+	if (sDepth == 0) {
+		ofPushStyle();
+		// ofPushStyle() doesn't cover the point size //
+		sUntrackedPointSizes.push_back(sPointSize);
+	} else {
+		sStack.push_back(sState);
+		sCounters.skipped++;
+	}
+}
+
+void ofxDatGuiRenderState::pop() {
+	if (sDepth == 0) {
+		ofPopStyle();
+		if (sUntrackedPointSizes.size() > 0) {
+			setPointSize(sUntrackedPointSizes.back());
+			sUntrackedPointSizes.pop_back();
+		}
+	} else if (sStack.size() > 0) {
+		// only whatever changed since push() is set back //
+		State saved = sStack.back();
+		sStack.pop_back();
+		apply(saved);
+		sCounters.skipped++;
+	}
+}
+
+void ofxDatGuiRenderState::apply(const State & s) {
+	setColor(s.color);
+	if (s.filled) {
+		fill();
+	} else {
+		noFill();
+	}
+	setLineWidth(s.lineWidth);
+	setPointSize(s.pointSize);
+}
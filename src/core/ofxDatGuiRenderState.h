@@ -0,0 +1,64 @@
+#pragma once
+
+#include "ofMain.h"
+
+// Shadow copy of the style state components touch while they draw.
+//
+// A gui pushes one style around its whole draw pass and starts tracking
+// with begin(). From then on color, fill and line width changes made
+// through the helpers below only reach the renderer when they actually
+// differ from what was set last, and push() / pop() save and restore that
+// shadow state instead of pushing the renderer's full style stack. Outside
+// of a tracked pass every helper forwards straight to its of* counterpart,
+// so components still draw correctly on their own.
+//
+// Code running inside a tracked pass must not change color, fill or line
+// width with the of* functions directly, or has to call invalidate()
+// afterwards so the shadow state is read back from the renderer.
+//
+// Point size isn't part of ofStyle, so push() / pop() save and restore it
+// here in and outside of tracked passes alike. It is never read back from
+// GL, which would stall on the GPU: the shadow starts at GL's default of 1
+// and follows setPointSize(), so point sizes have to be set through it.
+class ofxDatGuiRenderState {
+public:
+	struct Counters {
+		uint64_t issued = 0; // state changes that reached the renderer
+		uint64_t skipped = 0; // redundant changes and style pushes that were dropped
+	};
+
+	// Start / stop tracking. Passes nest, only the outermost one reads the current style.
+	static void begin();
+	static void end();
+	static bool isTracking() { return sDepth > 0; }
+
+	static void setColor(const ofColor & color);
+	static void fill();
+	static void noFill();
+	static void setLineWidth(float width);
+	static void setPointSize(float size);
+	static void push();
+	static void pop();
+	// Re-read the shadow state after color, fill or line width were changed behind our back.
+	static void invalidate();
+
+	static const Counters & getCounters() { return sCounters; }
+	static void resetCounters() { sCounters = Counters(); }
+
+private:
+	struct State {
+		ofColor color;
+		bool filled = true;
+		float lineWidth = 1;
+		float pointSize = 1;
+	};
+
+	static void apply(const State & s);
+
+	static State sState;
+	static vector<State> sStack;
+	static vector<float> sUntrackedPointSizes;
+	static float sPointSize;
+	static int sDepth;
+	static Counters sCounters;
+};
@@ -0,0 +1,160 @@
+#include "ofxDatGuiRenderer.h"
+
+ofxDatGuiRenderer * ofxDatGuiRenderer::mActive = nullptr;
+
+ofxDatGuiRenderer::ofxDatGuiRenderer()
+	: mPrevious(nullptr) {
+	mQuads.setMode(OF_PRIMITIVE_TRIANGLES);
+	mQuads.setUsage(GL_DYNAMIC_DRAW);
+}
+
+void ofxDatGuiRenderer::begin() {
+	if (mActive == this) return;
+	mPrevious = mActive;
+	mActive = this;
+}
+
+void ofxDatGuiRenderer::end() {
+	if (mActive != this) return;
+	flush();
+	mActive = mPrevious;
+	mPrevious = nullptr;
+}
+
+void ofxDatGuiRenderer::flush() {
+	flushGeometry();
+	flushText();
+}
+
+void ofxDatGuiRenderer::flushGeometry() {
+	if (mQuads.getNumIndices() == 0 && mImages.empty()) return;
+	ofxDatGuiRenderState::push();
+	ofxDatGuiRenderState::fill();
+	if (mQuads.getNumIndices() > 0) {
+		// vertex colors carry the tint, keep the global color neutral //
+		ofxDatGuiRenderState::setColor(ofColor(255));
+		mQuads.draw();
+		mQuads.clear();
+	}
+	for (auto & i : mImages) {
+		ofxDatGuiRenderState::setColor(i.color);
+		i.image->draw(i.x, i.y, i.w, i.h);
+	}
+	ofxDatGuiRenderState::pop();
+	mImages.clear();
+}
+
+void ofxDatGuiRenderer::flushText() {
+	bool pending = false;
+	for (auto & t : mText)
+		pending = pending || t.second.getNumIndices() > 0;
+	if (!pending) return;
+	ofxDatGuiRenderState::push();
+	ofxDatGuiRenderState::setColor(ofColor(255));
+	for (auto & t : mText) {
+		if (t.second.getNumIndices() == 0) continue;
+		t.first->texture().bind();
+		t.second.draw();
+		t.first->texture().unbind();
+		t.second.clear();
+	}
+	ofxDatGuiRenderState::pop();
+}
+
+void ofxDatGuiRenderer::addQuad(float x, float y, float w, float h, const ofColor & color) {
+	if (w <= 0 || h <= 0 || color.a == 0) return;
+	const ofIndexType i = mQuads.getNumVertices();
+	const ofFloatColor c(color);
+	mQuads.addVertex(glm::vec3(x, y, 0));
+	mQuads.addVertex(glm::vec3(x + w, y, 0));
+	mQuads.addVertex(glm::vec3(x + w, y + h, 0));
+	mQuads.addVertex(glm::vec3(x, y + h, 0));
+	for (int k = 0; k < 4; k++)
+		mQuads.addColor(c);
+	mQuads.addIndex(i);
+	mQuads.addIndex(i + 1);
+	mQuads.addIndex(i + 2);
+	mQuads.addIndex(i);
+	mQuads.addIndex(i + 2);
+	mQuads.addIndex(i + 3);
+}
+
+void ofxDatGuiRenderer::addText(ofxSmartFont * font, const ofMesh & glyphs, const ofColor & color) {
+	if (glyphs.getNumVertices() == 0 || color.a == 0) return;
+	auto it = mText.find(font);
+	if (it == mText.end()) {
+		it = mText.emplace(font, ofVboMesh()).first;
+		it->second.setMode(OF_PRIMITIVE_TRIANGLES);
+		it->second.setUsage(GL_DYNAMIC_DRAW);
+	}
+	ofVboMesh & batch = it->second;
+	const ofIndexType offset = batch.getNumVertices();
+	const ofFloatColor c(color);
+	batch.addVertices(glyphs.getVertices());
+	batch.addTexCoords(glyphs.getTexCoords());
+	for (size_t k = 0; k < glyphs.getNumVertices(); k++)
+		batch.addColor(c);
+	if (glyphs.getNumIndices() > 0) {
+		for (auto i : glyphs.getIndices())
+			batch.addIndex(offset + i);
+	} else {
+		for (size_t k = 0; k < glyphs.getNumVertices(); k++)
+			batch.addIndex(offset + k);
+	}
+}
+
+/*
+    static draw helpers
+*/
+
+void ofxDatGuiRenderer::rect(float x, float y, float w, float h, const ofColor & color) {
+	if (mActive != nullptr) {
+		mActive->addQuad(x, y, w, h, color);
+	} else {
+		ofxDatGuiRenderState::fill();
+		ofxDatGuiRenderState::setColor(color);
+		ofDrawRectangle(x, y, w, h);
+	}
+}
+
+void ofxDatGuiRenderer::rect(const ofRectangle & r, const ofColor & color) {
+	rect(r.x, r.y, r.width, r.height, color);
+}
+
+void ofxDatGuiRenderer::text(const shared_ptr<ofxSmartFont> & font, const string & s, float x, float y, const ofColor & color) {
+	if (mActive != nullptr) {
+		mActive->addText(font.get(), font->mesh(s, x, y, ofIsVFlipped()), color);
+	} else {
+		ofxDatGuiRenderState::setColor(color);
+		font->draw(s, x, y);
+	}
+}
+
+void ofxDatGuiRenderer::glyphs(const ofxDatGuiGlyphs & glyphs, const ofColor & color) {
+	if (!glyphs.mBuilt) return;
+	if (mActive != nullptr) {
+		mActive->addText(glyphs.mFont, glyphs.mMesh, color);
+	} else {
+		ofxDatGuiRenderState::setColor(color);
+		glyphs.mFont->texture().bind();
+		glyphs.mMesh.draw();
+		glyphs.mFont->texture().unbind();
+	}
+}
+
+void ofxDatGuiRenderer::image(const shared_ptr<ofImage> & img, float x, float y, float w, float h, const ofColor & color) {
+	if (mActive != nullptr) {
+		mActive->mImages.push_back({ img.get(), x, y, w, h, color });
+	} else {
+		ofxDatGuiRenderState::setColor(color);
+		img->draw(x, y, w, h);
+	}
+}
+
+void ofxDatGuiRenderer::sync() {
+	if (mActive != nullptr) mActive->flushGeometry();
+}
+
+void ofxDatGuiRenderer::overlay() {
+	if (mActive != nullptr) mActive->flush();
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "ofMain.h"
+#include "ofxSmartFont.h"
+#include "ofxDatGuiRenderState.h"
+
+// A pre-built glyph mesh for one line of text.
+//
+// ofTrueTypeFont::drawString() rebuilds the quads of every glyph each time
+// it is called. Text that rarely changes, like component labels, can instead
+// be baked once with build() and redrawn through ofxDatGuiRenderer::glyphs().
+// The quads are built at an absolute position, valid() reports whether they
+// still match the font, that position and the renderer's vertical flip. A
+// change of text has to be reported by the owner with invalidate().
+class ofxDatGuiGlyphs {
+public:
+	ofxDatGuiGlyphs()
+		: mFont(nullptr)
+		, mX(0)
+		, mY(0)
+		, mFlipped(false)
+		, mBuilt(false) {
+		mMesh.setMode(OF_PRIMITIVE_TRIANGLES);
+		mMesh.setUsage(GL_STATIC_DRAW);
+	}
+
+	bool valid(const shared_ptr<ofxSmartFont> & font, float x, float y) const {
+		return mBuilt && mFont == font.get() && mX == x && mY == y && mFlipped == ofIsVFlipped();
+	}
+
+	void build(const shared_ptr<ofxSmartFont> & font, const string & s, float x, float y) {
+		mFont = font.get();
+		mX = x;
+		mY = y;
+		mFlipped = ofIsVFlipped();
+		mMesh.clear();
+		mMesh.append(mFont->mesh(s, x, y, mFlipped));
+		mBuilt = true;
+	}
+
+	void invalidate() { mBuilt = false; }
+
+private:
+	friend class ofxDatGuiRenderer;
+	ofVboMesh mMesh;
+	ofxSmartFont * mFont;
+	float mX, mY;
+	bool mFlipped;
+	bool mBuilt;
+};
+
+// Batches the flat geometry of a gui into as few draw calls as possible.
+//
+// Every solid-colored quad (backgrounds, borders, stripes, slider fills,
+// group spacers, matrix cells...) is appended to a single ofVboMesh and
+// drawn with one call when the batch is flushed. Icons are queued alongside
+// and drawn after the quads.
+//
+// Text goes into a separate layer: the glyph quads of every string are
+// appended, with the string's color as vertex color, to one mesh per font
+// and drawn with a single texture bind and draw call when the batch ends.
+// Text is always drawn on top of everything else in the batch.
+//
+// Components never talk to a renderer instance directly, they call the
+// static helpers below. While no renderer is active the helpers draw
+// immediately, so components keep working outside of a batching gui.
+//
+// Components that draw anything else (lines, circles, polylines, fbos...)
+// must call ofxDatGuiRenderer::sync() first so that the quads and icons
+// queued so far land underneath their custom geometry. Text stays queued
+// and ends up above it. Geometry that has to cover text that was already
+// queued, like a popup overlapping the rows below it, calls overlay().
+class ofxDatGuiRenderer {
+public:
+	ofxDatGuiRenderer();
+
+	// Make this renderer the active batch. Renderers nest, so a component
+	// rendering into its own fbo can open a private batch inside the gui's.
+	void begin();
+	// Flush and restore whatever batch was active before begin().
+	void end();
+	// Draw everything queued so far: quads first, then icons, then text.
+	void flush();
+
+	static void rect(float x, float y, float w, float h, const ofColor & color);
+	static void rect(const ofRectangle & r, const ofColor & color);
+	static void text(const shared_ptr<ofxSmartFont> & font, const string & s, float x, float y, const ofColor & color);
+	// Draw text baked by ofxDatGuiGlyphs::build().
+	static void glyphs(const ofxDatGuiGlyphs & glyphs, const ofColor & color);
+	static void image(const shared_ptr<ofImage> & img, float x, float y, float w, float h, const ofColor & color);
+
+	// Flush the quads and icons of the active batch (if any) before drawing immediate geometry.
+	static void sync();
+	// Flush the active batch (if any) including its text, before drawing on top of it.
+	static void overlay();
+	static bool isBatching() { return mActive != nullptr; }
+
+private:
+	struct ImageItem {
+		ofImage * image;
+		float x, y, w, h;
+		ofColor color;
+	};
+
+	ofVboMesh mQuads;
+	// one text mesh per font, kept between frames so their buffers are reused //
+	std::map<ofxSmartFont *, ofVboMesh> mText;
+	vector<ImageItem> mImages;
+	ofxDatGuiRenderer * mPrevious;
+
+	void addQuad(float x, float y, float w, float h, const ofColor & color);
+	void addText(ofxSmartFont * font, const ofMesh & glyphs, const ofColor & color);
+	void flushGeometry();
+	void flushText();
+
+	static ofxDatGuiRenderer * mActive;
+};
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+class ofxDatGuiComponent;
+
+// Per-frame data of a gui's rows, kept as structure of arrays.
+//
+// Each top level component of a gui is one row. Its vertical extent lives
+// in the top / bottom arrays and its per-frame state in one flag byte, so
+// the passes that run every frame (finding the row under the mouse, asking
+// whether anything is pressed or needs repainting, culling rows outside
+// the window) stream through a few contiguous arrays instead of visiting
+// every component and its children.
+//
+// Components write their own flags as their state changes (see
+// ofxDatGuiComponent::bindRow()). Everything below a row shares it: a
+// pressed or dirty child marks its row pressed or dirty. Hover and
+// visibility describe the row's own component only.
+//
+// Hidden rows keep their slot with a zero height, so top and bottom stay
+// sorted and both can be binary searched.
+class ofxDatGuiRowStore {
+public:
+	enum Flag : uint8_t {
+		VISIBLE = 1 << 0,
+		HOVER = 1 << 1,
+		PRESS = 1 << 2,
+		DIRTY = 1 << 3
+	};
+
+	void clear() {
+		mTop.clear();
+		mBottom.clear();
+		mFlags.clear();
+		mRows.clear();
+	}
+
+	void resize(size_t n) {
+		mTop.resize(n, 0);
+		mBottom.resize(n, 0);
+		mFlags.resize(n, 0);
+		mRows.resize(n, nullptr);
+	}
+
+	void set(size_t row, ofxDatGuiComponent * c, float top, float bottom) {
+		mRows[row] = c;
+		mTop[row] = top;
+		mBottom[row] = bottom;
+	}
+
+	void setFlag(size_t row, uint8_t flag, bool on) {
+		if (on) {
+			mFlags[row] |= flag;
+		} else {
+			mFlags[row] &= ~flag;
+		}
+	}
+
+	// True if any row has the flag set.
+	bool any(uint8_t flag) const {
+		uint8_t all = 0;
+		for (uint8_t f : mFlags)
+			all |= f;
+		return (all & flag) != 0;
+	}
+
+	void clearFlag(uint8_t flag) {
+		for (uint8_t & f : mFlags)
+			f &= ~flag;
+	}
+
+	// The visible row containing y, or nullptr when y falls between rows.
+	ofxDatGuiComponent * find(float y) const {
+		size_t i = std::upper_bound(mTop.begin(), mTop.end(), y) - mTop.begin();
+		// step back over hidden rows collapsed onto the previous row's bottom //
+		while (i > 0 && !(mFlags[i - 1] & VISIBLE))
+			i--;
+		if (i == 0 || y > mBottom[i - 1]) return nullptr;
+		return mRows[i - 1];
+	}
+
+	// First and one past the last row overlapping [top, bottom].
+	std::pair<size_t, size_t> range(float top, float bottom) const {
+		size_t first = std::lower_bound(mBottom.begin(), mBottom.end(), top) - mBottom.begin();
+		size_t last = std::upper_bound(mTop.begin(), mTop.end(), bottom) - mTop.begin();
+		return { first, std::max(first, last) };
+	}
+
+	size_t size() const { return mRows.size(); }
+	ofxDatGuiComponent * component(size_t row) const { return mRows[row]; }
+	uint8_t flags(size_t row) const { return mFlags[row]; }
+	float top(size_t row) const { return mTop[row]; }
+	float bottom(size_t row) const { return mBottom[row]; }
+
+private:
+	std::vector<float> mTop;
+	std::vector<float> mBottom;
+	std::vector<uint8_t> mFlags;
+	std::vector<ofxDatGuiComponent *> mRows;
+};
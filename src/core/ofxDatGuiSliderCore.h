@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+// Value model of a slider for one value type.
+//
+// Holds min, max, value and precision as T and does the rounding, clamping,
+// scale and text conversions a slider needs. Integer types take an exact
+// path: no rounding and no float conversions of the value. Mapping to and
+// from the slider's 0..1 scale works on the distance from min as an
+// unsigned 64 bit integer, so min and max map exactly and only the scale
+// itself is a double, also where long double is no wider than double.
+// Typed text is parsed as an integer. Floating point types round with a
+// power of ten table instead of calling pow() for every value.
+template <typename T>
+class ofxDatGuiSliderCore {
+	static_assert(std::is_arithmetic<T>::value, "slider values have to be arithmetic");
+
+public:
+	static constexpr bool kExact = std::is_integral<T>::value;
+	static constexpr int kMaxPrecision = kExact ? 0 : (std::is_same<T, float>::value ? 4 : 9);
+	static constexpr int kDefaultPrecision = kExact ? 0 : 2;
+
+	ofxDatGuiSliderCore(T min, T max, T value, int precision = kDefaultPrecision)
+		: mMin(min)
+		, mMax(max)
+		, mValue(min) {
+		setPrecision(precision);
+		if (!setRange(min, max)) setRange(0, 100);
+		set(value);
+	}
+
+	// Returns false, and leaves the range alone, unless min < max.
+	bool setRange(T min, T max) {
+		if (!(min < max)) return false;
+		mMin = min;
+		mMax = max;
+		mValue = clamp(mValue);
+		return true;
+	}
+
+	void setPrecision(int precision) {
+		mPrecision = precision < 0 ? 0 : (precision > kMaxPrecision ? kMaxPrecision : precision);
+		mValue = clamp(round(mValue, mPrecision));
+	}
+
+	// Round and clamp value, returns true if that changed the value.
+	bool set(T value) {
+		value = clamp(round(value, mPrecision));
+		if (value == mValue) return false;
+		mValue = value;
+		return true;
+	}
+
+	T get() const { return mValue; }
+	T getMin() const { return mMin; }
+	T getMax() const { return mMax; }
+	int getPrecision() const { return mPrecision; }
+
+	double getScale() const {
+		if (kExact) return (double)offset(mValue) / (double)offset(mMax);
+		return (double)(((long double)mValue - (long double)mMin) / ((long double)mMax - (long double)mMin));
+	}
+
+	// The value at scale s (0..1), not yet rounded to the precision.
+	T fromScale(double s) const {
+		if (kExact) {
+			if (!(s > 0)) return mMin;
+			const double d = std::round(s * (double)offset(mMax));
+			// the span rounded to a double may be past it //
+			if (d >= (double)offset(mMax)) return mMax;
+			return (T)((unsigned long long)mMin + (unsigned long long)d);
+		}
+		const long double v = (long double)mMin + ((long double)mMax - (long double)mMin) * (long double)s;
+		return cast(v);
+	}
+
+	// Values at min or max are printed as short as possible, everything else with all its decimals.
+	std::string format() const {
+		if (kExact) return std::to_string(mValue);
+		char buf[64];
+		snprintf(buf, sizeof(buf), "%.*f", mPrecision, (double)mValue);
+		std::string s(buf);
+		if ((mValue == mMin || mValue == mMax) && s.find('.') != std::string::npos) {
+			s.erase(s.find_last_not_of('0') + 1);
+			if (s.back() == '.') s.pop_back();
+		}
+		return s;
+	}
+
+	// Parse text typed into the slider, returns false if it isn't a number.
+	static bool parse(const std::string & text, T & out) {
+		const char * begin = text.c_str();
+		char * end = nullptr;
+		if (kExact) {
+			const long long v = std::strtoll(begin, &end, 10);
+			if (end == begin) return false;
+			if (std::is_unsigned<T>::value && v == std::numeric_limits<long long>::max()) {
+				// strtoll saturated, the value may still fit an unsigned 64 bit slider //
+				out = saturate(std::strtoull(begin, nullptr, 10));
+			} else {
+				out = saturate(v);
+			}
+			// a fractional part typed into an integer slider rounds half away from zero //
+			if ((*end == '.' || *end == ',') && end[1] >= '5' && end[1] <= '9') {
+				const bool negative = text.find('-') < (size_t)(end - begin);
+				if (negative && out > std::numeric_limits<T>::lowest()) out--;
+				if (!negative && out < std::numeric_limits<T>::max()) out++;
+			}
+		} else {
+			const long double v = std::strtold(begin, &end);
+			if (end == begin) return false;
+			out = cast(v);
+		}
+		return true;
+	}
+
+	static T round(T value, int precision) {
+		if (kExact) return value;
+		const double p = pow10(precision);
+		return (T)(std::round((double)value * p) / p);
+	}
+
+	static double pow10(int precision) {
+		static const double kTable[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+		return kTable[precision < 0 ? 0 : (precision > 9 ? 9 : precision)];
+	}
+
+	// Integers round to nearest, floating point types just convert. Both saturate
+	// at the limits of T, a converted value out of T's range would be undefined.
+	static T cast(long double v) {
+		typedef std::numeric_limits<T> L;
+		if (v != v) return T(0);
+		if (v >= (long double)L::max()) return L::max();
+		if (v <= (long double)L::lowest()) return L::lowest();
+		return kExact ? (T)std::round(v) : (T)v;
+	}
+
+	// Typed integers clamped to T before they are narrowed, 3000000000 into an int is INT_MAX.
+	static T saturate(long long v) {
+		typedef std::numeric_limits<T> L;
+		if (v < 0 && !std::is_signed<T>::value) return T(0);
+		if (std::is_signed<T>::value && v < (long long)L::lowest()) return L::lowest();
+		if (v > 0 && (unsigned long long)v > (unsigned long long)L::max()) return L::max();
+		return (T)v;
+	}
+
+	static T saturate(unsigned long long v) {
+		typedef std::numeric_limits<T> L;
+		if (v > (unsigned long long)L::max()) return L::max();
+		return (T)v;
+	}
+
+private:
+	// distance from min, modulo 2^64 it is exact for every integer T //
+	unsigned long long offset(T v) const { return (unsigned long long)v - (unsigned long long)mMin; }
+
+	T clamp(T v) const { return v < mMin ? mMin : (v > mMax ? mMax : v); }
+
+	T mMin;
+	T mMax;
+	T mValue;
+	int mPrecision;
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+class ofxDatGuiComponent;
+
+// Y-sorted interval list over a column of vertically stacked components.
+//
+// Guis and expanded groups already know every row's y offset when they lay
+// out their children, so they record each visible row here and the row
+// under the mouse is found with a binary search instead of hit testing
+// every component. Rows must be added top to bottom and must not overlap,
+// which is what a vertical layout produces anyway.
+//
+// An index that was never built is inactive; containers without one let
+// every child take part in input resolution.
+class ofxDatGuiSpatialIndex {
+public:
+	ofxDatGuiSpatialIndex()
+		: mActive(false) { }
+
+	// Start a new layout pass, the index is active from here on.
+	void reset() {
+		mRows.clear();
+		mActive = true;
+	}
+
+	// Back to the inactive state (e.g. a collapsed group).
+	void clear() {
+		mRows.clear();
+		mActive = false;
+	}
+
+	void add(ofxDatGuiComponent * c, float top, float bottom) {
+		mRows.push_back({ top, bottom, c });
+	}
+
+	// Move every row by dy, for containers that moved without re-laying out.
+	void translate(float dy) {
+		for (auto & r : mRows) {
+			r.top += dy;
+			r.bottom += dy;
+		}
+	}
+
+	// The row containing y, or nullptr when y falls between rows.
+	ofxDatGuiComponent * find(float y) const {
+		auto it = std::upper_bound(mRows.begin(), mRows.end(), y,
+			[](float v, const Row & r) { return v < r.top; });
+		if (it == mRows.begin()) return nullptr;
+		--it;
+		return y <= it->bottom ? it->component : nullptr;
+	}
+
+	bool isActive() const { return mActive; }
+	size_t size() const { return mRows.size(); }
+	ofxDatGuiComponent * component(size_t i) const { return mRows[i].component; }
+	float height(size_t i) const { return mRows[i].bottom - mRows[i].top; }
+
+private:
+	struct Row {
+		float top;
+		float bottom;
+		ofxDatGuiComponent * component;
+	};
+
+	std::vector<Row> mRows;
+	bool mActive;
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Something a gui thread hands new values to, see ofxDatGuiSlider::bind().
+class ofxDatGuiPublisher {
+public:
+	virtual ~ofxDatGuiPublisher() { }
+	virtual void publish() = 0;
+};
+
+// Lock-free triple buffer for a struct of values shared with another thread.
+//
+// The gui thread edits a working copy (components bind to its members) and
+// publish() copies it into the back slot and swaps that with the middle
+// one. The consumer, an audio callback or worker thread, calls read() which
+// swaps the middle slot in as its front slot if something new was
+// published, and then reads the front slot for as long as it likes. Each
+// side only ever touches its own slot, one atomic exchange hands slots over,
+// so neither side waits on the other and the consumer never sees a struct
+// that is half written.
+//
+// Exactly one thread may publish and exactly one thread may read.
+template <typename T>
+class ofxDatGuiTripleBuffer : public ofxDatGuiPublisher {
+public:
+	explicit ofxDatGuiTripleBuffer(const T & initial = T())
+		: mWorking(initial)
+		, mBack(0)
+		, mFront(1)
+		, mState(2) {
+		for (auto & s : mSlots)
+			s = initial;
+	}
+
+	ofxDatGuiTripleBuffer(const ofxDatGuiTripleBuffer &) = delete;
+	ofxDatGuiTripleBuffer & operator=(const ofxDatGuiTripleBuffer &) = delete;
+
+	// Producer side, the working copy stays put so components can point into it.
+	T & edit() { return mWorking; }
+
+	void publish() override {
+		mSlots[mBack] = mWorking;
+		mBack = mState.exchange(mBack | kFresh, std::memory_order_acq_rel) & kIndex;
+	}
+
+	// Consumer side, the latest published values.
+	const T & read() {
+		if (mState.load(std::memory_order_relaxed) & kFresh) {
+			mFront = mState.exchange(mFront, std::memory_order_acq_rel) & kIndex;
+		}
+		return mSlots[mFront];
+	}
+
+	// True if read() would return something the consumer has not seen yet.
+	bool hasNew() const { return (mState.load(std::memory_order_acquire) & kFresh) != 0; }
+
+private:
+	static constexpr uint8_t kIndex = 3;
+	static constexpr uint8_t kFresh = 4;
+
+	T mSlots[3];
+	T mWorking;
+	uint8_t mBack; // owned by the producer
+	uint8_t mFront; // owned by the consumer
+	// index of the middle slot, plus kFresh while it holds an unread publish //
+	alignas(64) std::atomic<uint8_t> mState;
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "ofxDatGuiConstants.h"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// One cycle of a waveform, sampled into a fixed size table.
+//
+// render() fills a run of samples from a 32 bit fixed point phase
+// accumulator: the top bits of the phase index the table and the rest
+// interpolate between neighbouring entries, so a sample costs two loads
+// and a multiply-add instead of a sin() call. Every sample is computed
+// from its own index rather than from the previous one, which leaves the
+// loop free of dependencies for the compiler to vectorize. The phase
+// wraps on its own when it overflows.
+class ofxDatGuiWavetable {
+public:
+	static constexpr int kBits = 10;
+	static constexpr int kSize = 1 << kBits;
+
+	// The built in tables are built once and shared.
+	static const ofxDatGuiWavetable & get(ofxDatGuiWaveform shape) {
+		static const ofxDatGuiWavetable tables[] = {
+			ofxDatGuiWavetable(ofxDatGuiWaveform::SINE),
+			ofxDatGuiWavetable(ofxDatGuiWaveform::SQUARE),
+			ofxDatGuiWavetable(ofxDatGuiWaveform::SAW),
+			ofxDatGuiWavetable(ofxDatGuiWaveform::TRIANGLE)
+		};
+		return shape == ofxDatGuiWaveform::CUSTOM ? tables[0] : tables[(int)shape];
+	}
+
+	explicit ofxDatGuiWavetable(ofxDatGuiWaveform shape = ofxDatGuiWaveform::SINE)
+		: mTable(kSize + 1) {
+		for (int i = 0; i < kSize; i++) {
+			const double t = (double)i / kSize;
+			switch (shape) {
+			case ofxDatGuiWaveform::SQUARE: mTable[i] = t < 0.5 ? 1.0f : -1.0f; break;
+			case ofxDatGuiWaveform::SAW: mTable[i] = (float)(1.0 - 2.0 * t); break;
+			case ofxDatGuiWaveform::TRIANGLE: mTable[i] = (float)(t < 0.5 ? 4.0 * t - 1.0 : 3.0 - 4.0 * t); break;
+			default: mTable[i] = (float)std::sin(t * kTwoPi); break;
+			}
+		}
+		mTable[kSize] = mTable[0];
+	}
+
+	// A user supplied cycle of any length, resampled to the table size.
+	explicit ofxDatGuiWavetable(const std::vector<float> & cycle)
+		: mTable(kSize + 1, 0.0f) {
+		const size_t n = cycle.size();
+		if (n > 0) {
+			for (int i = 0; i < kSize; i++) {
+				const double p = (double)i * n / kSize;
+				const size_t a = (size_t)p;
+				const float f = (float)(p - a);
+				mTable[i] = cycle[a] + (cycle[(a + 1) % n] - cycle[a]) * f;
+			}
+		}
+		mTable[kSize] = mTable[0];
+	}
+
+	// Phase and increment in cycles, each sample is offset + table * amplitude.
+	void render(float * out, int count, double phase, double increment, float offset, float amplitude) const {
+		const uint32_t p0 = toFixed(phase);
+		const uint32_t inc = toFixed(increment);
+		const float * table = mTable.data();
+		const float scale = 1.0f / (1u << kFracBits);
+		for (int i = 0; i < count; i++) {
+			const uint32_t p = p0 + inc * (uint32_t)i;
+			const uint32_t idx = p >> kFracBits;
+			const float f = (float)(p & kFracMask) * scale;
+			const float a = table[idx];
+			out[i] = offset + (a + (table[idx + 1] - a) * f) * amplitude;
+		}
+	}
+
+private:
+	static constexpr double kTwoPi = 6.28318530717958647693;
+	static constexpr int kFracBits = 32 - kBits;
+	static constexpr uint32_t kFracMask = (1u << kFracBits) - 1;
+
+	static uint32_t toFixed(double cycles) {
+		const double frac = cycles - std::floor(cycles);
+		return (uint32_t)(int64_t)(frac * 4294967296.0);
+	}
+
+	// one guard entry past the end so interpolation never wraps the index //
+	std::vector<float> mTable;
+};
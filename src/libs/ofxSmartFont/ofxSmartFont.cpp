@@ -34,6 +34,16 @@ void ofxSmartFont::draw(std::string s, int x, int y)
     ttf.drawString(s, x, y);
 }
 
+const ofMesh& ofxSmartFont::mesh(const std::string& s, int x, int y, bool vflip)
+{
+    return ttf.getStringMesh(s, x, y, vflip);
+}
+
+const ofTexture& ofxSmartFont::texture()
+{
+    return ttf.getFontTexture();
+}
+
 std::string ofxSmartFont::name()
 {
     return mName;
@@ -37,6 +37,8 @@ class ofxSmartFont {
         std::string name();
         void name(std::string name);
         void draw(std::string s, int x, int y);
+        const ofMesh& mesh(const std::string& s, int x, int y, bool vflip);
+        const ofTexture& texture();
     
         ofRectangle rect(std::string s, int x=0, int y=0);
         float width(std::string s, int x=0, int y=0);
@@ -21,9 +21,8 @@
 */
 
 #include "ofxDatGui.h"
-
-ofxDatGui* ofxDatGui::mActiveGui;
-vector<ofxDatGui*> ofxDatGui::mGuis;
+#include <set>
+#include <tuple>
 
 ofxDatGui::ofxDatGui(int x, int y)
 {
@@ -41,12 +40,12 @@ ofxDatGui::ofxDatGui(ofxDatGuiAnchor anchor)
 
 ofxDatGui::~ofxDatGui()
 {
-    for (auto i:items) delete i;
-    mGuis.erase(std::remove(mGuis.begin(), mGuis.end(), this), mGuis.end());
-    if (mActiveGui == this) mActiveGui = mGuis.size() > 0 ? mGuis[0] : nullptr;
-    ofRemoveListener(ofEvents().draw, this, &ofxDatGui::onDraw, OF_EVENT_ORDER_AFTER_APP + mIndex);
-    ofRemoveListener(ofEvents().update, this, &ofxDatGui::onUpdate, OF_EVENT_ORDER_BEFORE_APP - mIndex);
-    ofRemoveListener(ofEvents().windowResized, this, &ofxDatGui::onWindowResized, OF_EVENT_ORDER_BEFORE_APP);
+    {
+    // the pool's chunks are freed in one go once nothing else is allocated from it //
+        ofxDatGuiPool::Teardown teardown(mAllocator.get());
+        for (auto i:items) delete i;
+    }
+    ofxDatGuiManager::get().remove(this);
 }
 
 void ofxDatGui::init()
@@ -61,6 +60,13 @@ void ofxDatGui::init()
     mWidthChanged = false;
     mThemeChanged = false;
     mAlignmentChanged = false;
+    mLayoutPending = false;
+    mBatchDepth = 0;
+    mBatchRendering = false;
+    mCachedRendering = false;
+    mCacheInvalid = true;
+    mCulling = false;
+    mRowsStale = true;
     mAlignment = ofxDatGuiAlignment::LEFT;
     mAlpha = 1.0f;
     mWidth = ofxDatGuiComponent::getTheme()->layout.width;
@@ -68,12 +74,11 @@ void ofxDatGui::init()
     mGuiBackground = ofxDatGuiComponent::getTheme()->color.guiBackground;
     
 // enable autodraw by default //
-    setAutoDraw(true, mGuis.size());
+    mAutoDraw = true;
+    mPriority = 0;
     
-// assign focus to this newly created gui //
-    mActiveGui = this;
-    mGuis.push_back(this);
-    ofAddListener(ofEvents().windowResized, this, &ofxDatGui::onWindowResized, OF_EVENT_ORDER_BEFORE_APP);
+// the manager puts this newly created gui on top and assigns it focus, and relays window resizes //
+    ofxDatGuiManager::get().add(this);
 }
 
 /* 
@@ -82,27 +87,19 @@ void ofxDatGui::init()
 
 void ofxDatGui::focus()
 {
-    if (mActiveGui!= this){
+    if (getFocused() == false){
     // enable and make visible if hidden //
         mVisible = true;
         mEnabled = true;
-        mActiveGui = this;
-    // update the draw order //
-        for (int i=0; i<mGuis.size(); i++) {
-            if (mGuis[i] == mActiveGui) {
-                std::swap(mGuis[i], mGuis[mGuis.size()-1]);
-                break;
-            }
-        }
-        for (int i=0; i<mGuis.size(); i++) {
-            if (mGuis[i]->getAutoDraw()) mGuis[i]->setAutoDraw(true, i);
-        }
+    // raise it to the top of the draw order //
+        ofxDatGuiManager::get().focus(this);
     }
 }
 
 void ofxDatGui::expand()
 {
     if (mGuiFooter != nullptr){
+        invalidateCache();
         mExpanded = true;
         mGuiFooter->setExpanded(mExpanded);
         mGuiFooter->setPosition(mPosition.x, mPosition.y + mHeight - mGuiFooter->getHeight() - mRowSpacing);
@@ -112,6 +109,7 @@ void ofxDatGui::expand()
 void ofxDatGui::collapse()
 {
     if (mGuiFooter != nullptr){
+        invalidateCache();
         mExpanded = false;
         mGuiFooter->setExpanded(mExpanded);
         mGuiFooter->setPosition(mPosition.x, mPosition.y);
@@ -130,7 +128,7 @@ bool ofxDatGui::getVisible()
 
 bool ofxDatGui::getFocused()
 {
-    return mActiveGui == this;
+    return ofxDatGuiManager::get().getFocused() == this;
 }
 
 void ofxDatGui::setWidth(int width, float labelWidth)
@@ -143,8 +141,10 @@ void ofxDatGui::setWidth(int width, float labelWidth)
 
 void ofxDatGui::setTheme(ofxDatGuiTheme* t, bool applyImmediately)
 {
-    if (applyImmediately){
+// inside a batch the theme is propagated once when the batch closes //
+    if (applyImmediately && mBatchDepth == 0){
         for(auto item:items) item->setTheme(t);
+        invalidateCache();
     }   else{
     // apply on next update call //
         mTheme = t;
@@ -182,15 +182,40 @@ void ofxDatGui::setEnabled(bool enabled)
     mEnabled = enabled;
 }
 
+/*
+    batch construction, defers layout & theme propagation while many components are added
+*/
+
+void ofxDatGui::beginBatch()
+{
+    mBatchDepth++;
+// folders defer their own relayout for as long as the gui does //
+    for (int i=0; i<items.size(); i++){
+        ofxDatGuiFolder* f = dynamic_cast<ofxDatGuiFolder*>(items[i]);
+        if (f != nullptr) f->beginBatch();
+    }
+}
+
+void ofxDatGui::endBatch()
+{
+    if (mBatchDepth == 0) return;
+// folders close first, their relayout only marks the gui for layout while it still batches //
+    for (int i=0; i<items.size(); i++){
+        ofxDatGuiFolder* f = dynamic_cast<ofxDatGuiFolder*>(items[i]);
+        if (f != nullptr) f->endBatch();
+    }
+    if (--mBatchDepth > 0) return;
+    applyPendingChanges();
+    if (mLayoutPending) layoutGui();
+}
+
 void ofxDatGui::setAutoDraw(bool autodraw, int priority)
 {
+// guis with a higher priority are drawn above and get input before those with a lower one //
     mAutoDraw = autodraw;
-    ofRemoveListener(ofEvents().draw, this, &ofxDatGui::onDraw, OF_EVENT_ORDER_AFTER_APP + mIndex);
-    ofRemoveListener(ofEvents().update, this, &ofxDatGui::onUpdate, OF_EVENT_ORDER_BEFORE_APP - mIndex);
-    if (mAutoDraw){
-        mIndex = priority;
-        ofAddListener(ofEvents().draw, this, &ofxDatGui::onDraw, OF_EVENT_ORDER_AFTER_APP + mIndex);
-        ofAddListener(ofEvents().update, this, &ofxDatGui::onUpdate, OF_EVENT_ORDER_BEFORE_APP - mIndex);
+    if (priority != mPriority){
+        mPriority = priority;
+        ofxDatGuiManager::get().reorder(this);
     }
 }
 
@@ -199,6 +224,93 @@ bool ofxDatGui::getAutoDraw()
     return mAutoDraw;
 }
 
+int ofxDatGui::getPriority()
+{
+    return mPriority;
+}
+
+/*
+    timing instrumentation, only collected when built with OFX_DATGUI_PROFILE
+*/
+
+void ofxDatGui::setProfileInstances(bool track)
+{
+    mStats.trackInstances = track;
+    if (track == false) mStats.instances.clear();
+}
+
+void ofxDatGui::resetStats()
+{
+    mStats.reset();
+}
+
+const ofxDatGuiStats& ofxDatGui::getStats()
+{
+    return mStats;
+}
+
+void ofxDatGui::setBatchRendering(bool batch)
+{
+// collect all flat geometry into a single mesh and draw it once per frame //
+    mBatchRendering = batch;
+}
+
+bool ofxDatGui::getBatchRendering()
+{
+    return mBatchRendering;
+}
+
+void ofxDatGui::setCachedRendering(bool cache)
+{
+// render into an fbo and only repaint the components that have changed //
+    mCachedRendering = cache;
+    if (mCachedRendering){
+        invalidateCache();
+    }   else{
+        mCache.clear();
+    }
+}
+
+bool ofxDatGui::getCachedRendering()
+{
+    return mCachedRendering;
+}
+
+void ofxDatGui::setCulling(bool cull)
+{
+// skip drawing rows that are outside of the window, only applies when not cached rendering //
+    mCulling = cull;
+}
+
+bool ofxDatGui::getCulling()
+{
+    return mCulling;
+}
+
+void ofxDatGui::setAllocator(std::shared_ptr<ofxDatGuiPool> pool)
+{
+// components added from now on are allocated from pool, existing ones keep their memory //
+// and with it the previous pool, their blocks only point at it //
+    if (mAllocator && mAllocator != pool) mRetiredAllocators.push_back(mAllocator);
+    mAllocator = pool;
+}
+
+std::shared_ptr<ofxDatGuiPool> ofxDatGui::getAllocator()
+{
+    return mAllocator;
+}
+
+void ofxDatGui::setQueuedDelivery(bool queued)
+{
+// hold back every value change until the end of update(), one event per component and frame //
+    mEvents.setQueued(queued);
+}
+
+bool ofxDatGui::getQueuedDelivery()
+{
+    return mEvents.getQueued();
+}
+
 bool ofxDatGui::getMouseDown()
 {
     return mMouseDown;
@@ -242,6 +354,7 @@ string ofxDatGui::getAssetPath()
 ofxDatGuiHeader* ofxDatGui::addHeader(string label, bool draggable)
 {
     if (mGuiHeader == nullptr){
+        ofxDatGuiPool::Scope alloc(mAllocator);
         mGuiHeader = new ofxDatGuiHeader(label, draggable);
         if (items.size() == 0){
             items.push_back(mGuiHeader);
@@ -249,6 +362,8 @@ ofxDatGuiHeader* ofxDatGui::addHeader(string label, bool draggable)
     // always ensure header is at the top of the panel //
             items.insert(items.begin(), mGuiHeader);
         }
+        mLookup.insert(nullptr, mGuiHeader);
+        mRowsStale = true;
         layoutGui();
 	}
     return mGuiHeader;
@@ -257,9 +372,12 @@ ofxDatGuiHeader* ofxDatGui::addHeader(string label, bool draggable)
 ofxDatGuiFooter* ofxDatGui::addFooter()
 {
     if (mGuiFooter == nullptr){
+        ofxDatGuiPool::Scope alloc(mAllocator);
         mGuiFooter = new ofxDatGuiFooter();
         items.push_back(mGuiFooter);
         mGuiFooter->onInternalEvent(this, &ofxDatGui::onInternalEventCallback);
+        mLookup.insert(nullptr, mGuiFooter);
+        mRowsStale = true;
         layoutGui();
 	}
     return mGuiFooter;
@@ -267,6 +385,7 @@ ofxDatGuiFooter* ofxDatGui::addFooter()
 
 ofxDatGuiLabel* ofxDatGui::addLabel(string label)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiLabel* lbl = new ofxDatGuiLabel(label);
     attachItem(lbl);
     return lbl;
@@ -274,32 +393,37 @@ ofxDatGuiLabel* ofxDatGui::addLabel(string label)
 
 ofxDatGuiButton* ofxDatGui::addButton(string label)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiButton* button = new ofxDatGuiButton(label);
-    button->onButtonEvent(this, &ofxDatGui::onButtonEventCallback);
+    button->forwardEvents(this);
     attachItem(button);
     return button;
 }
 
 ofxDatGuiToggle* ofxDatGui::addToggle(string label, bool enabled)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiToggle* button = new ofxDatGuiToggle(label, enabled);
-    button->onToggleEvent(this, &ofxDatGui::onToggleEventCallback);
+    button->forwardEvents(this);
     attachItem(button);
     return button;
 }
 
 ofxDatGuiSlider* ofxDatGui::addSlider(ofParameter<int>& p)
 {
-    ofxDatGuiSlider* slider = new ofxDatGuiSlider(p);
-    slider->onSliderEvent(this, &ofxDatGui::onSliderEventCallback);
+// int parameters take the exact integer path //
+    ofxDatGuiPool::Scope alloc(mAllocator);
+    ofxDatGuiSlider* slider = new ofxDatGuiSliderT<int>(p);
+    slider->forwardEvents(this);
     attachItem(slider);
     return slider;
 }
 
 ofxDatGuiSlider* ofxDatGui::addSlider(ofParameter<float>& p)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiSlider* slider = new ofxDatGuiSlider(p);
-    slider->onSliderEvent(this, &ofxDatGui::onSliderEventCallback);
+    slider->forwardEvents(this);
     attachItem(slider);
     return slider;
 }
@@ -313,30 +437,34 @@ ofxDatGuiSlider* ofxDatGui::addSlider(string label, float min, float max)
 
 ofxDatGuiSlider* ofxDatGui::addSlider(string label, float min, float max, float val)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiSlider* slider = new ofxDatGuiSlider(label, min, max, val);
-    slider->onSliderEvent(this, &ofxDatGui::onSliderEventCallback);
+    slider->forwardEvents(this);
     attachItem(slider);
     return slider;
 }
 
 ofxDatGuiTextInput* ofxDatGui::addTextInput(string label, string value)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiTextInput* input = new ofxDatGuiTextInput(label, value);
-    input->onTextInputEvent(this, &ofxDatGui::onTextInputEventCallback);
+    input->forwardEvents(this);
     attachItem(input);
     return input;
 }
 
 ofxDatGuiColorPicker* ofxDatGui::addColorPicker(string label, ofColor color)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiColorPicker* picker = new ofxDatGuiColorPicker(label, color);
-    picker->onColorPickerEvent(this, &ofxDatGui::onColorPickerEventCallback);
+    picker->forwardEvents(this);
     attachItem(picker);
     return picker;
 }
 
 ofxDatGuiWaveMonitor* ofxDatGui::addWaveMonitor(string label, float frequency, float amplitude)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiWaveMonitor* monitor = new ofxDatGuiWaveMonitor(label, frequency, amplitude);
     attachItem(monitor);
     return monitor;
@@ -344,34 +472,71 @@ ofxDatGuiWaveMonitor* ofxDatGui::addWaveMonitor(string label, float frequency, f
 
 ofxDatGuiValuePlotter* ofxDatGui::addValuePlotter(string label, float min, float max)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiValuePlotter* plotter = new ofxDatGuiValuePlotter(label, min, max);
     attachItem(plotter);
     return plotter;
 }
 
+ofxDatGuiMultiPlotter* ofxDatGui::addMultiPlotter(string label, float min, float max)
+{
+    ofxDatGuiPool::Scope alloc(mAllocator);
+    ofxDatGuiMultiPlotter* plotter = new ofxDatGuiMultiPlotter(label, min, max);
+    attachItem(plotter);
+    return plotter;
+}
+
 ofxDatGuiDropdown* ofxDatGui::addDropdown(string label, vector<string> options)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiDropdown* dropdown = new ofxDatGuiDropdown(label, options);
-    dropdown->onDropdownEvent(this, &ofxDatGui::onDropdownEventCallback);
+    dropdown->forwardEvents(this);
     attachItem(dropdown);
     return dropdown;
 }
 ofxDatGuiRadioGroup * ofxDatGui::addRadioGroup(const std::string & label, const std::vector<std::string> & options) {
+	ofxDatGuiPool::Scope alloc(mAllocator);
 	ofxDatGuiRadioGroup * rg = new ofxDatGuiRadioGroup(label, options);
-	rg->onRadioGroupEvent(this, &ofxDatGui::onRadioGroupEventCallback);
+	rg->forwardEvents(this);
 	attachItem(rg);
 	return rg;
 }
 
+ofxDatGuiCubicBezier * ofxDatGui::addCubicBezier(string label, float x1, float y1, float x2, float y2, float padAspect) {
+	ofxDatGuiPool::Scope alloc(mAllocator);
+	auto * bez = new ofxDatGuiCubicBezier(label, x1, y1, x2, y2, padAspect);
+	bez->forwardEvents(this);
+	attachItem(bez);
+	return bez;
+}
+
+ofxDatGuiCurveEditor * ofxDatGui::addCurveEditor(string label, float padAspect) {
+	ofxDatGuiPool::Scope alloc(mAllocator);
+	auto * curve = new ofxDatGuiCurveEditor(label, padAspect);
+	curve->forwardEvents(this);
+	attachItem(curve);
+	return curve;
+}
+
 ofxDatGuiFRM* ofxDatGui::addFRM(float refresh)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiFRM* monitor = new ofxDatGuiFRM(refresh);
     attachItem(monitor);
     return monitor;
 }
 
+ofxDatGuiStatsMonitor* ofxDatGui::addStatsMonitor(float refresh, int rows)
+{
+    ofxDatGuiPool::Scope alloc(mAllocator);
+    ofxDatGuiStatsMonitor* monitor = new ofxDatGuiStatsMonitor(&mStats, refresh, rows);
+    attachItem(monitor);
+    return monitor;
+}
+
 ofxDatGuiBreak* ofxDatGui::addBreak()
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiBreak* brk = new ofxDatGuiBreak();
     attachItem(brk);
     return brk;
@@ -379,42 +544,36 @@ ofxDatGuiBreak* ofxDatGui::addBreak()
 
 ofxDatGui2dPad* ofxDatGui::add2dPad(string label)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGui2dPad* pad = new ofxDatGui2dPad(label);
-    pad->on2dPadEvent(this, &ofxDatGui::on2dPadEventCallback);
+    pad->forwardEvents(this);
     attachItem(pad);
     return pad;
 }
 
 ofxDatGui2dPad* ofxDatGui::add2dPad(string label, ofRectangle bounds)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGui2dPad* pad = new ofxDatGui2dPad(label, bounds);
-    pad->on2dPadEvent(this, &ofxDatGui::on2dPadEventCallback);
+    pad->forwardEvents(this);
     attachItem(pad);
     return pad;
 }
 
 ofxDatGuiMatrix* ofxDatGui::addMatrix(string label, int numButtons, bool showLabels)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiMatrix* matrix = new ofxDatGuiMatrix(label, numButtons, showLabels);
-    matrix->onMatrixEvent(this, &ofxDatGui::onMatrixEventCallback);
+    matrix->forwardEvents(this);
     attachItem(matrix);
     return matrix;
 }
 
 ofxDatGuiFolder* ofxDatGui::addFolder(string label, ofColor color)
 {
+    ofxDatGuiPool::Scope alloc(mAllocator);
     ofxDatGuiFolder* folder = new ofxDatGuiFolder(label, color);
-    folder->onButtonEvent(this, &ofxDatGui::onButtonEventCallback);
-    folder->onToggleEvent(this, &ofxDatGui::onToggleEventCallback);
-    folder->onSliderEvent(this, &ofxDatGui::onSliderEventCallback);
-    folder->on2dPadEvent(this, &ofxDatGui::on2dPadEventCallback);
-    folder->onMatrixEvent(this, &ofxDatGui::onMatrixEventCallback);
-    folder->onTextInputEvent(this, &ofxDatGui::onTextInputEventCallback);
-    folder->onColorPickerEvent(this, &ofxDatGui::onColorPickerEventCallback);
-    folder->onInternalEvent(this, &ofxDatGui::onInternalEventCallback);
-	// LoopyDev
-	folder->onRadioGroupEvent(this, &ofxDatGui::onRadioGroupEventCallback);
-	folder->onDropdownEvent(this, &ofxDatGui::onDropdownEventCallback);
+    folder->forwardEvents(this);
 
     attachItem(folder);
     return folder;
@@ -429,6 +588,7 @@ ofxDatGuiFolder* ofxDatGui::addFolder(ofxDatGuiFolder* folder)
 // ofxDatGui.cpp
 
 ofxDatGuiPanel * ofxDatGui::addPanel(ofxDatGuiPanel::Orientation orientation) {
+	ofxDatGuiPool::Scope alloc(mAllocator);
 	auto * panel = new ofxDatGuiPanel(orientation);
 
 	// Use the global default theme  it's always valid.
@@ -453,363 +613,266 @@ void ofxDatGui::attachItem(ofxDatGuiComponent* item)
         items.push_back( item );
     }
     item->onInternalEvent(this, &ofxDatGui::onInternalEventCallback);
+    mLookup.insert(nullptr, item);
+    mRowsStale = true;
+// a folder added mid batch joins the batch it was added in //
+    ofxDatGuiFolder* f = dynamic_cast<ofxDatGuiFolder*>(item);
+    if (f != nullptr) for (int i=0; i<mBatchDepth; i++) f->beginBatch();
     layoutGui();
 }
 
 /*
     component retrieval methods
+    find*() returns nullptr on a miss and is what code that can miss should call,
+    get*() falls back to an inert placeholder so chained calls on a missing component stay harmless
 */
 
-ofxDatGuiLabel* ofxDatGui::getLabel(string bl, string fl){
-    ofxDatGuiLabel* o = nullptr;
-    if (fl != ""){
-        ofxDatGuiFolder* f = static_cast<ofxDatGuiFolder*>(getComponent(ofxDatGuiType::FOLDER, fl));
-        if (f) o = static_cast<ofxDatGuiLabel*>(f->getComponent(ofxDatGuiType::LABEL, bl));
-    } else {
-        o = static_cast<ofxDatGuiLabel*>(getComponent(ofxDatGuiType::LABEL, bl));
-    }
-    if (o==nullptr){
-        o = ofxDatGuiLabel::getInstance();
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, fl!="" ? fl+"-"+bl : bl);
-        trash.push_back(o);
+struct MissingProbe {
+    const string &first;
+    const string &second;
+};
+
+struct MissingOrder {
+    typedef void is_transparent;
+    template<typename A, typename B> bool operator()(const A &a, const B &b) const
+    {
+        return std::tie(a.first, a.second) < std::tie(b.first, b.second);
     }
+};
+
+static void logMissingComponent(const string &label, const string &folder = "")
+{
+// report every missing component only once, misses can happen every frame so the key is only built the first time //
+    static std::set<std::pair<string, string>, MissingOrder> reported;
+    if (reported.find(MissingProbe{folder, label}) != reported.end()) return;
+    reported.emplace(folder, label);
+    ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, folder != "" ? folder+"-"+label : label);
+}
+
+template<typename T>
+static T* inert(T* o)
+{
+    o->makeInert();
     return o;
 }
 
+template<typename T>
+static T* placeholder()
+{
+// one detached instance per type, never attached to a gui and never deleted //
+// it is inert, so listeners, binds and values set through one miss don't show up on the next //
+    static T* instance = inert(T::getInstance());
+    return instance;
+}
+
+template<typename T>
+T* ofxDatGui::findIn(ofxDatGuiType type, const string &label, const string &folder)
+{
+    if (folder == "") return static_cast<T*>(getComponent(type, label));
+    ofxDatGuiComponent* f = getComponent(ofxDatGuiType::FOLDER, folder);
+    return f ? static_cast<T*>(mLookup.findChild(f, type, label)) : nullptr;
+}
+
+template<typename T>
+T* ofxDatGui::orPlaceholder(T* o, const string &label, const string &folder)
+{
+    if (o != nullptr) return o;
+    logMissingComponent(label, folder);
+    return placeholder<T>();
+}
+
+ofxDatGuiLabel* ofxDatGui::findLabel(string bl, string fl)
+{
+    return findIn<ofxDatGuiLabel>(ofxDatGuiType::LABEL, bl, fl);
+}
+
+ofxDatGuiLabel* ofxDatGui::getLabel(string bl, string fl)
+{
+    return orPlaceholder(findLabel(bl, fl), bl, fl);
+}
+
+ofxDatGuiButton* ofxDatGui::findButton(string bl, string fl)
+{
+    return findIn<ofxDatGuiButton>(ofxDatGuiType::BUTTON, bl, fl);
+}
+
 ofxDatGuiButton* ofxDatGui::getButton(string bl, string fl)
 {
-    ofxDatGuiButton* o = nullptr;
-    if (fl != ""){
-        ofxDatGuiFolder* f = static_cast<ofxDatGuiFolder*>(getComponent(ofxDatGuiType::FOLDER, fl));
-        if (f) o = static_cast<ofxDatGuiButton*>(f->getComponent(ofxDatGuiType::BUTTON, bl));
-    }   else{
-        o = static_cast<ofxDatGuiButton*>(getComponent(ofxDatGuiType::BUTTON, bl));
-    }
-    if (o==nullptr){
-        o = ofxDatGuiButton::getInstance();
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, fl!="" ? fl+"-"+bl : bl);
-        trash.push_back(o);
-    }
-    return o;
+    return orPlaceholder(findButton(bl, fl), bl, fl);
+}
+
+ofxDatGuiToggle* ofxDatGui::findToggle(string bl, string fl)
+{
+    return findIn<ofxDatGuiToggle>(ofxDatGuiType::TOGGLE, bl, fl);
 }
 
 ofxDatGuiToggle* ofxDatGui::getToggle(string bl, string fl)
 {
-    ofxDatGuiToggle* o = nullptr;
-    if (fl != ""){
-        ofxDatGuiFolder* f = static_cast<ofxDatGuiFolder*>(getComponent(ofxDatGuiType::FOLDER, fl));
-        if (f) o = static_cast<ofxDatGuiToggle*>(f->getComponent(ofxDatGuiType::TOGGLE, bl));
-    }   else{
-        o = static_cast<ofxDatGuiToggle*>(getComponent(ofxDatGuiType::TOGGLE, bl));
-    }
-    if (o==nullptr){
-        o = ofxDatGuiToggle::getInstance();
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, fl!="" ? fl+"-"+bl : bl);
-        trash.push_back(o);
-    }
-    return o;
+    return orPlaceholder(findToggle(bl, fl), bl, fl);
+}
+
+ofxDatGuiSlider* ofxDatGui::findSlider(string sl, string fl)
+{
+    return findIn<ofxDatGuiSlider>(ofxDatGuiType::SLIDER, sl, fl);
 }
 
 ofxDatGuiSlider* ofxDatGui::getSlider(string sl, string fl)
 {
-    ofxDatGuiSlider* o = nullptr;
-    if (fl != ""){
-        ofxDatGuiFolder* f = static_cast<ofxDatGuiFolder*>(getComponent(ofxDatGuiType::FOLDER, fl));
-        if (f) o = static_cast<ofxDatGuiSlider*>(f->getComponent(ofxDatGuiType::SLIDER, sl));
-    }   else{
-        o = static_cast<ofxDatGuiSlider*>(getComponent(ofxDatGuiType::SLIDER, sl));
-    }
-    if (o==nullptr){
-        o = ofxDatGuiSlider::getInstance();
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, fl!="" ? fl+"-"+sl : sl);
-        trash.push_back(o);
-    }
-    return o;
+    return orPlaceholder(findSlider(sl, fl), sl, fl);
+}
+
+ofxDatGuiTextInput* ofxDatGui::findTextInput(string tl, string fl)
+{
+    return findIn<ofxDatGuiTextInput>(ofxDatGuiType::TEXT_INPUT, tl, fl);
 }
 
 ofxDatGuiTextInput* ofxDatGui::getTextInput(string tl, string fl)
 {
-    ofxDatGuiTextInput* o = nullptr;
-    if (fl != ""){
-        ofxDatGuiFolder* f = static_cast<ofxDatGuiFolder*>(getComponent(ofxDatGuiType::FOLDER, fl));
-        if (f) o = static_cast<ofxDatGuiTextInput*>(f->getComponent(ofxDatGuiType::TEXT_INPUT, tl));
-    }   else{
-        o = static_cast<ofxDatGuiTextInput*>(getComponent(ofxDatGuiType::TEXT_INPUT, tl));
-    }
-    if (o==nullptr){
-        o = ofxDatGuiTextInput::getInstance();
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, fl!="" ? fl+"-"+tl : tl);
-        trash.push_back(o);
-    }
-    return o;
+    return orPlaceholder(findTextInput(tl, fl), tl, fl);
+}
+
+ofxDatGui2dPad* ofxDatGui::find2dPad(string pl, string fl)
+{
+    return findIn<ofxDatGui2dPad>(ofxDatGuiType::PAD2D, pl, fl);
 }
 
 ofxDatGui2dPad* ofxDatGui::get2dPad(string pl, string fl)
 {
-    ofxDatGui2dPad* o = nullptr;
-    if (fl != ""){
-        ofxDatGuiFolder* f = static_cast<ofxDatGuiFolder*>(getComponent(ofxDatGuiType::FOLDER, fl));
-        if (f) o = static_cast<ofxDatGui2dPad*>(f->getComponent(ofxDatGuiType::PAD2D, pl));
-    }   else{
-        o = static_cast<ofxDatGui2dPad*>(getComponent(ofxDatGuiType::PAD2D, pl));
-    }
-    if (o==nullptr){
-        o = ofxDatGui2dPad::getInstance();
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, fl!="" ? fl+"-"+pl : pl);
-        trash.push_back(o);
-    }
-    return o;
+    return orPlaceholder(find2dPad(pl, fl), pl, fl);
 }
 
-ofxDatGuiColorPicker* ofxDatGui::getColorPicker(string cl, string fl)
+ofxDatGuiColorPicker* ofxDatGui::findColorPicker(string cl, string fl)
 {
-    ofxDatGuiColorPicker* o = nullptr;
-    if (fl != ""){
-        ofxDatGuiFolder* f = static_cast<ofxDatGuiFolder*>(getComponent(ofxDatGuiType::FOLDER, fl));
-        if (f) o = static_cast<ofxDatGuiColorPicker*>(f->getComponent(ofxDatGuiType::COLOR_PICKER, cl));
-    }   else{
-        o = static_cast<ofxDatGuiColorPicker*>(getComponent(ofxDatGuiType::COLOR_PICKER, cl));
-    }
-    if (o==nullptr){
-        o = ofxDatGuiColorPicker::getInstance();
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, fl!="" ? fl+"-"+cl : cl);
-        trash.push_back(o);
-    }
-    return o;
+    return findIn<ofxDatGuiColorPicker>(ofxDatGuiType::COLOR_PICKER, cl, fl);
 }
 
-ofxDatGuiWaveMonitor* ofxDatGui::getWaveMonitor(string cl, string fl)
+ofxDatGuiColorPicker* ofxDatGui::getColorPicker(string cl, string fl)
 {
-    ofxDatGuiWaveMonitor* o = nullptr;
-    if (fl != ""){
-        ofxDatGuiFolder* f = static_cast<ofxDatGuiFolder*>(getComponent(ofxDatGuiType::FOLDER, fl));
-        if (f) o = static_cast<ofxDatGuiWaveMonitor*>(f->getComponent(ofxDatGuiType::WAVE_MONITOR, cl));
-    }   else{
-        o = static_cast<ofxDatGuiWaveMonitor*>(getComponent(ofxDatGuiType::WAVE_MONITOR, cl));
-    }
-    if (o==nullptr){
-        o = ofxDatGuiWaveMonitor::getInstance();
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, fl!="" ? fl+"-"+cl : cl);
-        trash.push_back(o);
-    }
-    return o;
+    return orPlaceholder(findColorPicker(cl, fl), cl, fl);
 }
 
-ofxDatGuiValuePlotter* ofxDatGui::getValuePlotter(string cl, string fl)
+ofxDatGuiWaveMonitor* ofxDatGui::findWaveMonitor(string cl, string fl)
 {
-    ofxDatGuiValuePlotter* o = nullptr;
-    if (fl != ""){
-        ofxDatGuiFolder* f = static_cast<ofxDatGuiFolder*>(getComponent(ofxDatGuiType::FOLDER, fl));
-        if (f) o = static_cast<ofxDatGuiValuePlotter*>(f->getComponent(ofxDatGuiType::VALUE_PLOTTER, cl));
-    }   else{
-        o = static_cast<ofxDatGuiValuePlotter*>(getComponent(ofxDatGuiType::VALUE_PLOTTER, cl));
-    }
-    if (o==nullptr){
-        o = ofxDatGuiValuePlotter::getInstance();
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, fl!="" ? fl+"-"+cl : cl);
-        trash.push_back(o);
-    }
-    return o;
+    return findIn<ofxDatGuiWaveMonitor>(ofxDatGuiType::WAVE_MONITOR, cl, fl);
 }
 
-ofxDatGuiMatrix* ofxDatGui::getMatrix(string ml, string fl)
+ofxDatGuiWaveMonitor* ofxDatGui::getWaveMonitor(string cl, string fl)
 {
-    ofxDatGuiMatrix* o = nullptr;
-    if (fl != ""){
-        ofxDatGuiFolder* f = static_cast<ofxDatGuiFolder*>(getComponent(ofxDatGuiType::FOLDER, fl));
-        if (f) o = static_cast<ofxDatGuiMatrix*>(f->getComponent(ofxDatGuiType::MATRIX, ml));
-    }   else{
-        o = static_cast<ofxDatGuiMatrix*>(getComponent(ofxDatGuiType::MATRIX, ml));
-    }
-    if (o==nullptr){
-        o = ofxDatGuiMatrix::getInstance();
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, fl!="" ? fl+"-"+ml : ml);
-        trash.push_back(o);
-    }
-    return o;
+    return orPlaceholder(findWaveMonitor(cl, fl), cl, fl);
 }
 
-ofxDatGuiDropdown* ofxDatGui::getDropdown(string dl)
+ofxDatGuiValuePlotter* ofxDatGui::findValuePlotter(string cl, string fl)
 {
-    ofxDatGuiDropdown* o = static_cast<ofxDatGuiDropdown*>(getComponent(ofxDatGuiType::DROPDOWN, dl));
-    if (o==NULL){
-        o = ofxDatGuiDropdown::getInstance();
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, dl);
-        trash.push_back(o);
-    }
-    return o;
+    return findIn<ofxDatGuiValuePlotter>(ofxDatGuiType::VALUE_PLOTTER, cl, fl);
 }
-// LoopyDev: Radio Groups
-ofxDatGuiRadioGroup * ofxDatGui::getRadioGroup(string rl) {
-	auto * o = static_cast<ofxDatGuiRadioGroup *>(getComponent(ofxDatGuiType::RADIO_GROUP, rl));
-	if (o == nullptr) {
-		o = ofxDatGuiRadioGroup::getInstance();
-		ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, rl);
-		trash.push_back(o);
-	}
-	return o;
+
+ofxDatGuiValuePlotter* ofxDatGui::getValuePlotter(string cl, string fl)
+{
+    return orPlaceholder(findValuePlotter(cl, fl), cl, fl);
 }
 
-ofxDatGuiButtonBar * ofxDatGui::getButtonBar(string bl) {
-	auto * o = static_cast<ofxDatGuiButtonBar *>(getComponent(ofxDatGuiType::BUTTON_BAR, bl));
-	if (o == nullptr) {
-		o = ofxDatGuiButtonBar::getInstance();
-		ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, bl);
-		trash.push_back(o);
-	}
-	return o;
+ofxDatGuiMultiPlotter* ofxDatGui::findMultiPlotter(string cl, string fl)
+{
+    return findIn<ofxDatGuiMultiPlotter>(ofxDatGuiType::MULTI_PLOTTER, cl, fl);
 }
 
+ofxDatGuiMultiPlotter* ofxDatGui::getMultiPlotter(string cl, string fl)
+{
+    return orPlaceholder(findMultiPlotter(cl, fl), cl, fl);
+}
 
-ofxDatGuiFolder* ofxDatGui::getFolder(string fl)
+ofxDatGuiMatrix* ofxDatGui::findMatrix(string ml, string fl)
 {
-    ofxDatGuiFolder* o = static_cast<ofxDatGuiFolder*>(getComponent(ofxDatGuiType::FOLDER, fl));
-    if (o==NULL){
-        o = ofxDatGuiFolder::getInstance();
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, fl);
-        trash.push_back(o);
-    }
-    return o;
+    return findIn<ofxDatGuiMatrix>(ofxDatGuiType::MATRIX, ml, fl);
 }
 
-ofxDatGuiHeader* ofxDatGui::getHeader()
+ofxDatGuiMatrix* ofxDatGui::getMatrix(string ml, string fl)
 {
-    ofxDatGuiHeader* o;
-    if (mGuiHeader != nullptr){
-        o = mGuiHeader;
-    }   else{
-        o = new ofxDatGuiHeader("X");
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, "HEADER");
-        trash.push_back(o);
-    }
-    return o;
+    return orPlaceholder(findMatrix(ml, fl), ml, fl);
 }
 
-ofxDatGuiFooter* ofxDatGui::getFooter()
+ofxDatGuiDropdown* ofxDatGui::findDropdown(string dl)
 {
-    ofxDatGuiFooter* o;
-    if (mGuiFooter != nullptr){
-        o = mGuiFooter;
-    }   else{
-        o = new ofxDatGuiFooter();
-        ofxDatGuiLog::write(ofxDatGuiMsg::COMPONENT_NOT_FOUND, "FOOTER");
-        trash.push_back(o);
-    }
-    return o;
+    return findIn<ofxDatGuiDropdown>(ofxDatGuiType::DROPDOWN, dl);
 }
 
-ofxDatGuiComponent* ofxDatGui::getComponent(ofxDatGuiType type, string label)
+ofxDatGuiDropdown* ofxDatGui::getDropdown(string dl)
 {
-    for (int i=0; i<items.size(); i++) {
-        if (items[i]->getType() == type){
-            if (items[i]->is(label)) return items[i];
-        }
-    // iterate over component's children and return the first match we find //
-        for (int j=0; j<items[i]->children.size(); j++) {
-            if (items[i]->children[j]->is(label)) return items[i]->children[j];
-        }
-    }
-    return NULL;
+    return orPlaceholder(findDropdown(dl), dl);
 }
 
-/*
-    event callbacks
-*/
+ofxDatGuiRadioGroup* ofxDatGui::findRadioGroup(string rl)
+{
+    return findIn<ofxDatGuiRadioGroup>(ofxDatGuiType::RADIO_GROUP, rl);
+}
 
-void ofxDatGui::onButtonEventCallback(ofxDatGuiButtonEvent e)
+ofxDatGuiRadioGroup* ofxDatGui::getRadioGroup(string rl)
 {
-    if (buttonEventCallback != nullptr) {
-        buttonEventCallback(e);
-    }   else{
-        ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-    }
+    return orPlaceholder(findRadioGroup(rl), rl);
 }
 
-void ofxDatGui::onToggleEventCallback(ofxDatGuiToggleEvent e)
+ofxDatGuiButtonBar* ofxDatGui::findButtonBar(string bl)
 {
-    if (toggleEventCallback != nullptr) {
-        toggleEventCallback(e);
-// allow toggle events to decay into button events //
-    }   else if (buttonEventCallback != nullptr) {
-        buttonEventCallback(ofxDatGuiButtonEvent(e.target));
-    }   else{
-        ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-    }
+    return findIn<ofxDatGuiButtonBar>(ofxDatGuiType::BUTTON_BAR, bl);
 }
 
-void ofxDatGui::onSliderEventCallback(ofxDatGuiSliderEvent e)
+ofxDatGuiButtonBar* ofxDatGui::getButtonBar(string bl)
 {
-    if (sliderEventCallback != nullptr) {
-        sliderEventCallback(e);
-    }   else{
-        ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-    }
+    return orPlaceholder(findButtonBar(bl), bl);
 }
 
-void ofxDatGui::onTextInputEventCallback(ofxDatGuiTextInputEvent e)
+ofxDatGuiFolder* ofxDatGui::findFolder(string fl)
 {
-    if (textInputEventCallback != nullptr) {
-        textInputEventCallback(e);
-    }   else{
-        ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-    }
+    return findIn<ofxDatGuiFolder>(ofxDatGuiType::FOLDER, fl);
 }
 
-void ofxDatGui::onDropdownEventCallback(ofxDatGuiDropdownEvent e)
+ofxDatGuiFolder* ofxDatGui::getFolder(string fl)
 {
-    if (dropdownEventCallback != nullptr) {
-        dropdownEventCallback(e);
-    }   else{
-        ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-    }
-// adjust the gui after a dropdown is closed //
-    layoutGui();
+    return orPlaceholder(findFolder(fl), fl);
 }
-// LoopyDev: Radio Groups
-void ofxDatGui::onRadioGroupEventCallback(ofxDatGuiRadioGroupEvent e) {
-	if (radioGroupEventCallback != nullptr) {
-		radioGroupEventCallback(e);
-	} else {
-		ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-	}
+
+ofxDatGuiHeader* ofxDatGui::getHeader()
+{
+    if (mGuiHeader != nullptr) return mGuiHeader;
+    static const string key = "HEADER";
+    logMissingComponent(key);
+    static ofxDatGuiHeader* header = inert(new ofxDatGuiHeader("X"));
+    return header;
 }
 
-void ofxDatGui::on2dPadEventCallback(ofxDatGui2dPadEvent e)
+ofxDatGuiFooter* ofxDatGui::getFooter()
 {
-    if (pad2dEventCallback != nullptr) {
-        pad2dEventCallback(e);
-    }   else{
-        ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-    }
+    if (mGuiFooter != nullptr) return mGuiFooter;
+    static const string key = "FOOTER";
+    logMissingComponent(key);
+    static ofxDatGuiFooter* footer = inert(new ofxDatGuiFooter());
+    return footer;
 }
 
-void ofxDatGui::onColorPickerEventCallback(ofxDatGuiColorPickerEvent e)
+ofxDatGuiComponent* ofxDatGui::getComponent(ofxDatGuiType type, string label)
 {
-    if (colorPickerEventCallback != nullptr) {
-        colorPickerEventCallback(e);
-    }   else{
-        ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-    }
+// hashed on (type, name) at any depth, label may also be a path like "Render/Bloom/Threshold" //
+    return mLookup.find(type, label);
 }
 
-void ofxDatGui::onMatrixEventCallback(ofxDatGuiMatrixEvent e)
+ofxDatGuiComponent* ofxDatGui::findComponent(ofxDatGuiType type, string path)
 {
-    if (matrixEventCallback != nullptr) {
-        matrixEventCallback(e);
-    }   else{
-        ofxDatGuiLog::write(ofxDatGuiMsg::EVENT_HANDLER_NULL);
-    }
+    return getComponent(type, path);
 }
 
+/*
+    event callbacks
+*/
+
 void ofxDatGui::onInternalEventCallback(ofxDatGuiInternalEvent e)
 {
 // these events are not dispatched out to the main application //
     if (e.type == ofxDatGuiEventType::GROUP_TOGGLED){
-        layoutGui();
+        layoutGui(e.index);
     }   else if (e.type == ofxDatGuiEventType::GUI_TOGGLED){
         mExpanded ? collapse() : expand();
     }   else if (e.type == ofxDatGuiEventType::VISIBILITY_CHANGED){
-        layoutGui();
+        layoutGui(e.index);
     }
 }
 
@@ -836,6 +899,11 @@ void ofxDatGui::moveGui(ofPoint pt)
 
 void ofxDatGui::layoutGui()
 {
+    if (mBatchDepth > 0){
+        mLayoutPending = true;
+        return;
+    }
+    mLayoutPending = false;
     mHeight = 0;
     for (int i=0; i<items.size(); i++) {
         items[i]->setIndex(i);
@@ -846,12 +914,64 @@ void ofxDatGui::layoutGui()
     positionGui();
 }
 
+void ofxDatGui::layoutGui(int from)
+{
+// anchored to the bottom every item moves with the height, so lay out everything //
+    bool bottom = mAnchor == ofxDatGuiAnchor::BOTTOM_LEFT || mAnchor == ofxDatGuiAnchor::BOTTOM_RIGHT;
+    if (bottom || !mExpanded || mBatchDepth > 0 || from < 0 || from >= items.size() || items[from]->getIndex() != from){
+        layoutGui();
+        return;
+    }
+// the changed item starts right below the closest visible item above it //
+    int y = mPosition.y;
+    for (int i=from-1; i>-1; i--){
+        if (items[i]->getVisible() == false) continue;
+        y = items[i]->getY() + items[i]->getHeight() + mRowSpacing;
+        break;
+    }
+    if (items[from]->getVisible()){
+        if (items[from]->getY() != y) items[from]->setPosition(mPosition.x, y);
+        y += items[from]->getHeight() + mRowSpacing;
+    }
+// everything below only moves by the change in height //
+    int dy = 0;
+    int to = -1;
+    bool measured = false;
+    for (int i=from+1; i<items.size(); i++){
+        if (items[i]->getVisible() == false) continue;
+        if (!measured){
+            dy = y - items[i]->getY();
+            measured = true;
+        // nothing below moved, only the rows up to here need re-indexing //
+            if (dy == 0){
+                to = i;
+                break;
+            }
+        }
+        items[i]->setPosition(mPosition.x, items[i]->getY() + dy);
+    }
+    mHeight = 0;
+    for (int i=items.size()-1; i>-1; i--){
+        if (items[i]->getVisible() == false) continue;
+        mHeight = items[i]->getY() + items[i]->getHeight() + mRowSpacing - mPosition.y;
+        break;
+    }
+    mGuiBounds = ofRectangle(mPosition.x, mPosition.y, mWidth, mHeight);
+    indexItems(from, to);
+    invalidateCache();
+    ofxDatGuiInput::invalidate();
+}
+
 void ofxDatGui::positionGui()
 {
 /*
     ofGetWidth/ofGetHeight returns incorrect values after retina windows are resized in version 0.9.1 & 0.9.2
     https://github.com/openframeworks/openFrameworks/pull/4858
 */
+    if (mBatchDepth > 0){
+        mLayoutPending = true;
+        return;
+    }
     int multiplier = 1;
     if (ofxDatGuiIsHighResolution() && ofGetVersionMajor() == 0 && ofGetVersionMinor() == 9 && (ofGetVersionPatch() == 1 || ofGetVersionPatch() == 2)){
         multiplier = 2;
@@ -876,20 +996,54 @@ void ofxDatGui::positionGui()
         items[i]->setPosition(mPosition.x, mPosition.y + h);
         h += items[i]->getHeight() + mRowSpacing;
     }
+    indexItems();
     // move the footer back to the top of the gui //
     if (!mExpanded) mGuiFooter->setPosition(mPosition.x, mPosition.y);
     mGuiBounds = ofRectangle(mPosition.x, mPosition.y, mWidth, mHeight);
+    invalidateCache();
+// components may have moved under the mouse //
+    ofxDatGuiInput::invalidate();
+}
+
+void ofxDatGui::indexItems(int from, int to)
+{
+// rebinding visits every component, only do it when this gui's items were added or removed //
+// children that containers add later bind themselves, see ofxDatGuiComponent::adoptChild() //
+    bool rebind = mRowsStale || mRows.size() != items.size();
+    if (rebind){
+        mRows.clear();
+        mRows.resize(items.size());
+        from = 0;
+        to = -1;
+    }
+// only rows in [from, to) moved, the others keep their entries //
+    if (to < 0 || to > (int)items.size()) to = items.size();
+    from = std::max(0, std::min(from, to));
+    float bottom = from > 0 ? mRows.bottom(from-1) : mPosition.y;
+    for (int i=from; i<to; i++) {
+    // hidden rows collapse onto the bottom of the row above them so the store stays sorted //
+        if (items[i]->getVisible()){
+            bottom = items[i]->getY() + items[i]->getHeight();
+            mRows.set(i, items[i], items[i]->getY(), bottom);
+        }   else{
+            mRows.set(i, items[i], bottom, bottom);
+        }
+        if (rebind){
+            items[i]->bindRow(&mRows, i);
+            items[i]->bindEventQueue(&mEvents);
+        }
+    }
+    mRowsStale = false;
 }
 
 /* 
     update & draw loop
 */
 
-void ofxDatGui::update()
+void ofxDatGui::applyPendingChanges()
 {
-    if (!mVisible) return;
-
-    // check if we need to update components //
+// nothing reaches the components until the batch closes //
+    if (mBatchDepth > 0) return;
     for (int i=0; i<items.size(); i++) {
         if (mAlphaChanged) items[i]->setOpacity(mAlpha);
         if (mThemeChanged) items[i]->setTheme(mTheme);
@@ -898,95 +1052,303 @@ void ofxDatGui::update()
     }
     
     if (mThemeChanged || mWidthChanged) layoutGui();
+    if (mAlphaChanged || mAlignmentChanged) invalidateCache();
 
     mTheme = nullptr;
     mAlphaChanged = false;
     mWidthChanged = false;
     mThemeChanged = false;
     mAlignmentChanged = false;
+}
+
+void ofxDatGui::update()
+{
+    if (!mVisible){
+    // values set from code while hidden still go out //
+        mEvents.flush();
+        return;
+    }
+    OFX_DATGUI_PROFILE_GUI(mStats, UPDATE);
+
+    applyPendingChanges();
     
-    // check for gui focus change //
-    if (ofGetMousePressed() && mActiveGui->mMoving == false){
-        ofPoint mouse = ofPoint(ofGetMouseX(), ofGetMouseY());
-        for (int i=mGuis.size()-1; i>-1; i--){
-        // ignore guis that are invisible //
-            if (mGuis[i]->getVisible() && mGuis[i]->hitTest(mouse)){
-                if (mGuis[i] != mActiveGui) mGuis[i]->focus();
-                break;
-            }
-        }
+    // focus is arbitrated once per frame across all guis //
+    ofxDatGuiManager::get().resolveFocus();
+    const ofxDatGuiInput::Snapshot & input = ofxDatGuiInput::get();
+
+    // only the row under the mouse (and whatever still holds the press or hover) resolves input //
+    // the rows are indexed by y alone, so an open popup like a color picker covering the rows below //
+    // its own is checked first and takes the mouse instead of the row underneath it //
+    if (input.hasInput && mExpanded){
+        ofxDatGuiComponent* hit = ofxDatGuiComponent::getPopupAt(input.mouse);
+        if (hit == nullptr) hit = mRows.find(input.mouse.y);
+        if (hit != nullptr) hit->markInputCandidate(input.mouse);
     }
 
     if (!getFocused() || !mEnabled){
     // update children but ignore mouse & keyboard events //
-        for (int i=0; i<items.size(); i++) items[i]->update(false);
+        updateRows(false);
     }   else {
         mMoving = false;
         mMouseDown = false;
     // this gui has focus so let's see if any of its components were interacted with //
         if (mExpanded == false){
-            mGuiFooter->update();
+            {
+                OFX_DATGUI_PROFILE_COMPONENT(mGuiFooter, UPDATE);
+                mGuiFooter->update();
+            }
             mMouseDown = mGuiFooter->getMouseDown();
 		} else {
-			// 1) Update every item; sPressOwner in the component layer guarantees only the owner reacts.
-			for (int i = 0; i < items.size(); ++i) {
-				items[i]->update(true);
-			}
+			// 1) Update every visible row; only the marked candidates resolve input and sPressOwner
+			//    in the component layer guarantees only the owner reacts.
+			updateRows(true);
 
-			// 2) Panel-level mMouseDown = any descendant is down
-			auto anyMouseDown = [&](auto && self, ofxDatGuiComponent * node) -> bool {
-				if (node->getMouseDown()) return true;
-				for (auto * c : node->children)
-					if (self(self, c)) return true;
-				return false;
-			};
-			mMouseDown = false;
-			for (int i = 0; i < items.size() && !mMouseDown; ++i) {
-				if (anyMouseDown(anyMouseDown, items[i])) mMouseDown = true;
-			}
+			// 2) Panel-level mMouseDown = any descendant is down, every row records that in its flags
+			mMouseDown = mRows.any(ofxDatGuiRowStore::PRESS);
 
 			// 3) Only drag the panel when the header itself is pressed (so other presses don't move it)
 			if (mGuiHeader != nullptr && mGuiHeader->getDraggable() && mGuiHeader->getMouseDown()) {
 				mMoving = true;
-				ofPoint mouse(ofGetMouseX(), ofGetMouseY());
-				moveGui(mouse - mGuiHeader->getDragOffset());
+				ofPoint pos = input.mouse - mGuiHeader->getDragOffset();
+				if (pos != mPosition) moveGui(pos);
 			}
 		
 
 		}
 
     }
-// empty the trash //
-    for (int i=0; i<trash.size(); i++) delete trash[i];
-    trash.clear();
+// everything held back this frame goes out in one batch, after input was resolved //
+    mEvents.flush();
+}
+
+void ofxDatGui::updateRows(bool acceptEvents)
+{
+// walk the row store, hidden rows are skipped the same way groups skip their hidden children //
+    ofxDatGuiComponent::beginIndexedInput();
+    if (mRows.size() == items.size()){
+        for (size_t i=0; i<mRows.size(); i++) {
+            if (!(mRows.flags(i) & ofxDatGuiRowStore::VISIBLE)) continue;
+            ofxDatGuiComponent* row = mRows.component(i);
+            OFX_DATGUI_PROFILE_COMPONENT(row, UPDATE);
+            row->update(acceptEvents);
+        }
+    }   else{
+    // not laid out yet //
+        for (int i=0; i<items.size(); i++) {
+            OFX_DATGUI_PROFILE_COMPONENT(items[i], UPDATE);
+            items[i]->update(acceptEvents);
+        }
+    }
+    ofxDatGuiComponent::endIndexedInput();
 }
 
 void ofxDatGui::draw()
 {
     if (mVisible == false) return;
+    OFX_DATGUI_PROFILE_GUI(mStats, DRAW);
+    if (mCachedRendering){
+        renderCache();
+        ofPushStyle();
+        // the cache already holds the gui at mAlpha, premultiplied, so it's composited as is //
+            ofSetColor(ofColor::white);
+            ofEnableBlendMode(OF_BLENDMODE_ALPHA);
+            glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+            mCache.draw(mPosition.x + mCacheRect.x, mPosition.y + mCacheRect.y);
+        ofPopStyle();
+    }   else{
+        renderItems();
+    }
+}
+
+static void visibleRange(float &top, float &bottom)
+{
+// the current viewport (the window, or the fbo being rendered into) mapped back into gui space //
+// through the model matrix, so translated, scaled or cached guis cull against what is really on screen //
+    glm::mat4 model = glm::inverse(ofGetCurrentViewMatrix()) * ofGetCurrentMatrix(OF_MATRIX_MODELVIEW);
+    glm::mat4 toGui = glm::inverse(model);
+    ofRectangle vp = ofGetCurrentViewport();
+    top = std::numeric_limits<float>::max();
+    bottom = std::numeric_limits<float>::lowest();
+    const float cx[4] = {0, vp.width, 0, vp.width};
+    const float cy[4] = {0, 0, vp.height, vp.height};
+    for (int i=0; i<4; i++){
+        glm::vec4 p = toGui * glm::vec4(cx[i], cy[i], 0, 1);
+        top = std::min(top, p.y);
+        bottom = std::max(bottom, p.y);
+    }
+}
+
+void ofxDatGui::renderItems()
+{
     ofPushStyle();
-        ofFill();
-        ofSetColor(mGuiBackground, mAlpha * 255);
+    ofxDatGuiRenderState::begin();
+    if (mBatchRendering) mRenderer.begin();
+        ofColor bkgd(mGuiBackground, mAlpha * 255);
         if (mExpanded == false){
-            ofDrawRectangle(mPosition.x, mPosition.y, mWidth, mGuiFooter->getHeight());
+            ofxDatGuiRenderer::rect(mPosition.x, mPosition.y, mWidth, mGuiFooter->getHeight(), bkgd);
+            OFX_DATGUI_PROFILE_COMPONENT(mGuiFooter, DRAW);
             mGuiFooter->draw();
         }   else{
-            ofDrawRectangle(mPosition.x, mPosition.y, mWidth, mHeight - mRowSpacing);
-            for (int i=0; i<items.size(); i++) items[i]->draw();
+            ofxDatGuiRenderer::rect(mPosition.x, mPosition.y, mWidth, mHeight - mRowSpacing, bkgd);
+            size_t first = 0, last = items.size();
+            bool indexed = mRows.size() == items.size();
+            if (indexed && mCulling){
+        // only the rows overlapping the viewport, the row store is sorted top to bottom //
+                float top, bottom;
+                visibleRange(top, bottom);
+                std::pair<size_t, size_t> r = mRows.range(top, bottom);
+                first = r.first;
+                last = r.second;
+            }
+            for (size_t i=first; i<last; i++) {
+                if (indexed && !(mRows.flags(i) & ofxDatGuiRowStore::VISIBLE)) continue;
+                OFX_DATGUI_PROFILE_COMPONENT(items[i], DRAW);
+                items[i]->draw();
+            }
         // color pickers overlap other components when expanded so they must be drawn last //
-            for (int i=0; i<items.size(); i++) items[i]->drawColorPicker();
+            for (size_t i=first; i<last; i++) items[i]->drawColorPicker();
         }
+    if (mBatchRendering) mRenderer.end();
+    ofxDatGuiRenderState::end();
     ofPopStyle();
 }
 
-void ofxDatGui::onDraw(ofEventArgs &e)
+/*
+    cached rendering
+*/
+
+static bool overlaps(const ofRectangle &a, const ofRectangle &b)
+{
+// edges that merely touch don't count, adjacent rows would otherwise pull each other in //
+    return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+static void premultiply()
+{
+// color is blended as usual but alpha accumulates, so the fbo ends up holding premultiplied color //
+    ofEnableBlendMode(OF_BLENDMODE_ALPHA);
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+void ofxDatGui::invalidateCache()
 {
-    draw();
+    mCacheInvalid = true;
+}
+
+void ofxDatGui::getDrawUnits(ofxDatGuiComponent* item)
+{
+// children of an open folder or dropdown can be repainted on their own, everything else is repainted whole //
+    if (item->getVisible() == false) return;
+    bool isGroup = item->getType() == ofxDatGuiType::FOLDER || item->getType() == ofxDatGuiType::DROPDOWN;
+    if (isGroup && item->getIsExpanded() && item->isDirty(false) == false){
+        for (auto c:item->children) getDrawUnits(c);
+    }   else{
+        mDrawUnits.push_back(item);
+    }
 }
 
-void ofxDatGui::onUpdate(ofEventArgs &e)
+void ofxDatGui::renderCache()
 {
-    update();
+// nothing in any row changed since the last repaint, skip walking the component tree //
+    if (mCacheInvalid == false && mRows.size() == items.size() && mRows.any(ofxDatGuiRowStore::DIRTY) == false) return;
+    mDrawUnits.clear();
+    if (mExpanded == false){
+        mDrawUnits.push_back(mGuiFooter);
+    }   else{
+        for (auto item:items) getDrawUnits(item);
+    }
+    ofRectangle bkgd(mPosition.x, mPosition.y, mWidth, mExpanded ? mHeight - mRowSpacing : mGuiFooter->getHeight());
+
+    ofRectangle damage;
+    if (mCacheInvalid == false){
+    // collect the area covered by everything that changed, both where it was and where it is now //
+        bool changed = false;
+        mRedraw.assign(mDrawUnits.size(), false);
+        for (int i=0; i<mDrawUnits.size(); i++){
+            if (mDrawUnits[i]->isDirty() == false) continue;
+            ofRectangle now = mDrawUnits[i]->getDrawBounds();
+            ofRectangle was = mDrawUnits[i]->getLastDrawBounds();
+            if (changed == false) damage = now;
+            damage.growToInclude(now);
+            if (!was.isEmpty()) damage.growToInclude(was);
+            mRedraw[i] = changed = true;
+        }
+        if (changed == false){
+        // whatever flagged a row is hidden and not drawn //
+            mRows.clearFlag(ofxDatGuiRowStore::DIRTY);
+            return;
+        }
+    // anything partially covered by the damaged area has to be repainted whole //
+        bool grown = true;
+        while (grown){
+            grown = false;
+            for (int i=0; i<mDrawUnits.size(); i++){
+                if (mRedraw[i]) continue;
+                ofRectangle r = mDrawUnits[i]->getDrawBounds();
+                if (overlaps(r, damage)){
+                    damage.growToInclude(r);
+                    mRedraw[i] = grown = true;
+                }
+            }
+        }
+        ofRectangle cache(mPosition.x + mCacheRect.x, mPosition.y + mCacheRect.y, mCacheRect.width, mCacheRect.height);
+        if (!cache.inside(damage.getTopLeft()) || !cache.inside(damage.getBottomRight())) mCacheInvalid = true;
+    }
+
+    if (mCacheInvalid){
+        ofRectangle bounds = bkgd;
+        for (auto u:mDrawUnits) bounds.growToInclude(u->getDrawBounds());
+        int w = max(1, (int)ceil(bounds.width));
+        int h = max(1, (int)ceil(bounds.height));
+        if (!mCache.isAllocated() || mCache.getWidth() < w || mCache.getHeight() < h){
+            mCache.allocate(max(w, (int)mCache.getWidth()), max(h, (int)mCache.getHeight()), GL_RGBA);
+        }
+        mCacheRect = ofRectangle(bounds.x - mPosition.x, bounds.y - mPosition.y, mCache.getWidth(), mCache.getHeight());
+        mCache.begin();
+            ofClear(0, 0, 0, 0);
+            ofPushStyle();
+            premultiply();
+            ofPushMatrix();
+            ofTranslate(-(mPosition.x + mCacheRect.x), -(mPosition.y + mCacheRect.y));
+            renderItems();
+            ofPopMatrix();
+            ofPopStyle();
+        mCache.end();
+        for (auto u:mDrawUnits) u->clearDirty();
+        mRows.clearFlag(ofxDatGuiRowStore::DIRTY);
+        mCacheInvalid = false;
+        return;
+    }
+
+    mCache.begin();
+        ofPushMatrix();
+        ofTranslate(-(mPosition.x + mCacheRect.x), -(mPosition.y + mCacheRect.y));
+        ofPushStyle();
+        // wipe the damaged area and put the gui background back //
+            ofFill();
+            ofEnableBlendMode(OF_BLENDMODE_DISABLED);
+            ofSetColor(0, 0, 0, 0);
+            ofDrawRectangle(damage);
+            premultiply();
+            if (overlaps(bkgd, damage)){
+                ofSetColor(mGuiBackground, mAlpha * 255);
+                ofDrawRectangle(bkgd.getIntersection(damage));
+            }
+            ofxDatGuiRenderState::begin();
+            if (mBatchRendering) mRenderer.begin();
+            for (int i=0; i<mDrawUnits.size(); i++) {
+                if (mRedraw[i] == false) continue;
+                OFX_DATGUI_PROFILE_COMPONENT(mDrawUnits[i], DRAW);
+                mDrawUnits[i]->draw();
+            }
+            for (int i=0; i<mDrawUnits.size(); i++) if (mRedraw[i]) mDrawUnits[i]->drawColorPicker();
+            if (mBatchRendering) mRenderer.end();
+            ofxDatGuiRenderState::end();
+        ofPopStyle();
+        ofPopMatrix();
+    mCache.end();
+    for (int i=0; i<mDrawUnits.size(); i++) if (mRedraw[i]) mDrawUnits[i]->clearDirty();
+    mRows.clearFlag(ofxDatGuiRowStore::DIRTY);
 }
 
 void ofxDatGui::onWindowResized(ofResizeEventArgs &e)
@@ -997,6 +1359,7 @@ void ofxDatGui::onWindowResized(ofResizeEventArgs &e)
 
 ofxDatGuiButtonBar * ofxDatGui::addButtonBar(const std::string & label,
 	const std::vector<std::string> & buttons) {
+	ofxDatGuiPool::Scope alloc(mAllocator);
 	auto * bar = new ofxDatGuiButtonBar(label, buttons);
 
 	// Wire each inner button into the gui's normal button callback,
@@ -1004,7 +1367,7 @@ ofxDatGuiButtonBar * ofxDatGui::addButtonBar(const std::string & label,
 	for (auto * child : bar->children) {
 		if (child->getType() == ofxDatGuiType::BUTTON) {
 			auto * btn = static_cast<ofxDatGuiButton *>(child);
-			btn->onButtonEvent(this, &ofxDatGui::onButtonEventCallback);
+			btn->forwardEvents(this);
 		}
 	}
 
@@ -27,6 +27,8 @@
 //#include "ofxDatGuiRadioGroup.h"
 #include "ofxDatGuiButtonBar.h"
 #include "ofxDatGuiPanel.h"
+#include "ofxDatGuiManager.h"
+#include "ofxDatGuiLookupIndex.h"
 
 
 class ofxDatGui : public ofxDatGuiInteractiveObject
@@ -53,7 +55,17 @@ class ofxDatGui : public ofxDatGuiInteractiveObject
         void setPosition(ofxDatGuiAnchor anchor);
         void setTheme(ofxDatGuiTheme* t, bool applyImmediately = false);
         void setAutoDraw(bool autodraw, int priority = 0);
+        void beginBatch();
+        void endBatch();
+        void setBatchRendering(bool batch);
+        void setCachedRendering(bool cache);
+        void setCulling(bool cull);
+        void setAllocator(std::shared_ptr<ofxDatGuiPool> pool);
+        void setQueuedDelivery(bool queued);
         void setLabelAlignment(ofxDatGuiAlignment align);
+        void setProfileInstances(bool track);
+        void resetStats();
+        const ofxDatGuiStats& getStats();
         static void setAssetPath(string path);
         static string getAssetPath();
     
@@ -62,6 +74,12 @@ class ofxDatGui : public ofxDatGuiInteractiveObject
         bool getFocused();
         bool getVisible();
         bool getAutoDraw();
+        int getPriority();
+        bool getBatchRendering();
+        bool getCachedRendering();
+        bool getCulling();
+        std::shared_ptr<ofxDatGuiPool> getAllocator();
+        bool getQueuedDelivery();
         bool getMouseDown();
         ofPoint getPosition();
     
@@ -74,14 +92,32 @@ class ofxDatGui : public ofxDatGuiInteractiveObject
         ofxDatGuiSlider* addSlider(string label, float min, float max, float val);
         ofxDatGuiSlider* addSlider(ofParameter<int> & p);
         ofxDatGuiSlider* addSlider(ofParameter<float> & p);
+        template<typename T> ofxDatGuiSliderT<T>* addSliderT(string label, T min, T max, T val)
+        {
+            ofxDatGuiPool::Scope alloc(mAllocator);
+            ofxDatGuiSliderT<T>* slider = new ofxDatGuiSliderT<T>(label, min, max, val);
+            slider->forwardEvents(this);
+            attachItem(slider);
+            return slider;
+        }
+        template<typename T> ofxDatGuiSliderT<T>* addSliderT(ofParameter<T> & p)
+        {
+            ofxDatGuiPool::Scope alloc(mAllocator);
+            ofxDatGuiSliderT<T>* slider = new ofxDatGuiSliderT<T>(p);
+            slider->forwardEvents(this);
+            attachItem(slider);
+            return slider;
+        }
         ofxDatGuiTextInput* addTextInput(string label, string value = "");
         ofxDatGuiDropdown* addDropdown(string label, vector<string> options);
         ofxDatGuiFRM* addFRM(float refresh = 1.0f);
+        ofxDatGuiStatsMonitor* addStatsMonitor(float refresh = 1.0f, int rows = 4);
         ofxDatGuiBreak* addBreak();
         ofxDatGui2dPad* add2dPad(string label);
         ofxDatGui2dPad* add2dPad(string label, ofRectangle bounds);
         ofxDatGuiWaveMonitor* addWaveMonitor(string label, float min, float max);
         ofxDatGuiValuePlotter* addValuePlotter(string label, float min, float max);
+        ofxDatGuiMultiPlotter* addMultiPlotter(string label, float min, float max);
         ofxDatGuiColorPicker* addColorPicker(string label, ofColor color = ofColor::black);
         ofxDatGuiMatrix* addMatrix(string label, int numButtons, bool showLabels = false);
         ofxDatGuiFolder* addFolder(string label, ofColor color = ofColor::white);
@@ -90,21 +126,11 @@ class ofxDatGui : public ofxDatGuiInteractiveObject
         ofxDatGuiCubicBezier* addCubicBezier(string label,
             float x1 = 0.25f, float y1 = 0.10f,
             float x2 = 0.25f, float y2 = 1.00f,
-            float padAspect = 1.0f)
-		{
-			auto * bez = new ofxDatGuiCubicBezier(label, x1, y1, x2, y2, padAspect);
-			// If you later want GUI-level routing, you can add a callback like other components.
-			attachItem(bez);
-			return bez;
-		}
+            float padAspect = 1.0f);
 		// LoopyDev: add Radio Groups
 		ofxDatGuiRadioGroup * addRadioGroup(const std::string & label, const std::vector<std::string> & options);
 		// LoopyDev: add Curve Editor
-		ofxDatGuiCurveEditor * addCurveEditor(string label, float padAspect) {
-			auto * curve = new ofxDatGuiCurveEditor("Response Curve", 0.6f /*padAspect*/);
-			attachItem(curve);
-			return curve;
-		};
+		ofxDatGuiCurveEditor * addCurveEditor(string label, float padAspect = 1.0f);
 		// --- LoopyDev: add horizontal button bar ---
 		ofxDatGuiButtonBar * addButtonBar(const std::string & label,
 			const std::vector<std::string> & buttons);
@@ -123,16 +149,37 @@ class ofxDatGui : public ofxDatGuiInteractiveObject
         ofxDatGuiMatrix* getMatrix(string label, string folder = "");
         ofxDatGuiWaveMonitor* getWaveMonitor(string label, string folder = "");
         ofxDatGuiValuePlotter* getValuePlotter(string label, string folder = "");
+        ofxDatGuiMultiPlotter* getMultiPlotter(string label, string folder = "");
         ofxDatGuiFolder* getFolder(string label);
         ofxDatGuiDropdown* getDropdown(string label);
 		// LoopyDev: get Radio Groups
 		ofxDatGuiRadioGroup * getRadioGroup(string label);
 		// LoopyDev: get Button Bars
 		ofxDatGuiButtonBar * getButtonBar(string label);
+    
+    // same lookups but they return nullptr when nothing matches //
+        ofxDatGuiLabel* findLabel(string label, string folder = "");
+        ofxDatGuiButton* findButton(string label, string folder = "");
+        ofxDatGuiToggle* findToggle(string label, string folder = "");
+        ofxDatGuiSlider* findSlider(string label, string folder = "");
+        ofxDatGui2dPad* find2dPad(string label, string folder = "");
+        ofxDatGuiTextInput* findTextInput(string label, string folder = "");
+        ofxDatGuiColorPicker* findColorPicker(string label, string folder = "");
+        ofxDatGuiMatrix* findMatrix(string label, string folder = "");
+        ofxDatGuiWaveMonitor* findWaveMonitor(string label, string folder = "");
+        ofxDatGuiValuePlotter* findValuePlotter(string label, string folder = "");
+        ofxDatGuiMultiPlotter* findMultiPlotter(string label, string folder = "");
+        ofxDatGuiFolder* findFolder(string label);
+        ofxDatGuiDropdown* findDropdown(string label);
+        ofxDatGuiRadioGroup* findRadioGroup(string label);
+        ofxDatGuiButtonBar* findButtonBar(string label);
+    // any component by type and name or slash separated path, e.g. "Render/Bloom/Threshold" //
+        ofxDatGuiComponent* findComponent(ofxDatGuiType type, string path);
 
     private:
     
-        int mIndex;
+        friend class ofxDatGuiManager;
+    
         int mWidth;
         int mHeight;
         int mRowSpacing;
@@ -143,12 +190,30 @@ class ofxDatGui : public ofxDatGuiInteractiveObject
         bool mEnabled;
         bool mExpanded;
         bool mAutoDraw;
+        int mPriority;
         bool mMouseDown;
         bool mAlphaChanged;
         bool mWidthChanged;
         bool mThemeChanged;
         bool mAlignmentChanged;
+        bool mLayoutPending;
+        int mBatchDepth;
+        bool mBatchRendering;
+        bool mCachedRendering;
+        bool mCacheInvalid;
+        bool mCulling;
         ofColor mGuiBackground;
+        ofxDatGuiRenderer mRenderer;
+        ofFbo mCache;
+        ofRectangle mCacheRect;
+        vector<ofxDatGuiComponent*> mDrawUnits;
+        vector<bool> mRedraw;
+        ofxDatGuiRowStore mRows;
+        bool mRowsStale;
+        std::shared_ptr<ofxDatGuiPool> mAllocator;
+        vector<std::shared_ptr<ofxDatGuiPool>> mRetiredAllocators;
+        ofxDatGuiEventQueue mEvents;
+        ofxDatGuiStats mStats;
     
         ofPoint mPosition;
         ofRectangle mGuiBounds;
@@ -158,40 +223,30 @@ class ofxDatGui : public ofxDatGuiInteractiveObject
         ofxDatGuiTheme* mTheme;
         ofxDatGuiAlignment mAlignment;
         vector<ofxDatGuiComponent*> items;
-        vector<ofxDatGuiComponent*> trash;
-        static ofxDatGui* mActiveGui;
-        static vector<ofxDatGui*> mGuis;
+        ofxDatGuiLookupIndex mLookup;
         static std::unique_ptr<ofxDatGuiTheme> theme;
     
         void init();
         void layoutGui();
+        void layoutGui(int from);
     	void positionGui();
+        void indexItems(int from = 0, int to = -1);
+        void updateRows(bool acceptEvents);
         void moveGui(ofPoint pt);
         bool hitTest(ofPoint pt);
         void attachItem(ofxDatGuiComponent* item);
+        void applyPendingChanges();
+        void renderItems();
+        void renderCache();
+        void invalidateCache();
+        void getDrawUnits(ofxDatGuiComponent* item);
     
-        void onDraw(ofEventArgs &e);
-        void onUpdate(ofEventArgs &e);
         void onWindowResized(ofResizeEventArgs &e);
     
         ofxDatGuiComponent* getComponent(string key);
         ofxDatGuiComponent* getComponent(ofxDatGuiType type, string label);
+        template<typename T> T* findIn(ofxDatGuiType type, const string &label, const string &folder = "");
+        template<typename T> T* orPlaceholder(T* o, const string &label, const string &folder = "");
         void onInternalEventCallback(ofxDatGuiInternalEvent e);
-        void onButtonEventCallback(ofxDatGuiButtonEvent e);
-        void onToggleEventCallback(ofxDatGuiToggleEvent e);
-        void onSliderEventCallback(ofxDatGuiSliderEvent e);
-        void onTextInputEventCallback(ofxDatGuiTextInputEvent e);
-        void onDropdownEventCallback(ofxDatGuiDropdownEvent e);
-        void on2dPadEventCallback(ofxDatGui2dPadEvent e);
-        void onColorPickerEventCallback(ofxDatGuiColorPickerEvent e);
-        void onMatrixEventCallback(ofxDatGuiMatrixEvent e);
-		// LoopyDev: Radio Groups
-		void onRadioGroupEventCallback(ofxDatGuiRadioGroupEvent e);
-		std::function<void(ofxDatGuiRadioGroupEvent)> radioGroupEventCallback;
-		template <typename T>
-		void onRadioGroupEvent(T * listener, void (T::*handler)(ofxDatGuiRadioGroupEvent)) {
-			radioGroupEventCallback = std::bind(handler, listener, std::placeholders::_1);
-		}
-
 
 };
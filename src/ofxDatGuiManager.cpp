@@ -0,0 +1,93 @@
+#include "ofxDatGuiManager.h"
+#include "ofxDatGui.h"
+
+ofxDatGuiManager::ofxDatGuiManager()
+	: mFocused(nullptr)
+	, mResolvedFrame(std::numeric_limits<uint64_t>::max()) {
+	ofAddListener(ofEvents().update, this, &ofxDatGuiManager::onUpdate, OF_EVENT_ORDER_BEFORE_APP);
+	ofAddListener(ofEvents().draw, this, &ofxDatGuiManager::onDraw, OF_EVENT_ORDER_AFTER_APP);
+	ofAddListener(ofEvents().windowResized, this, &ofxDatGuiManager::onWindowResized, OF_EVENT_ORDER_BEFORE_APP);
+}
+
+ofxDatGuiManager & ofxDatGuiManager::get() {
+	// intentionally leaked, guis may be destroyed during static teardown //
+	static ofxDatGuiManager * manager = new ofxDatGuiManager();
+	return *manager;
+}
+
+void ofxDatGuiManager::insertOnTop(ofxDatGui * gui) {
+	// above every gui of the same or a lower priority //
+	auto it = std::upper_bound(mGuis.begin(), mGuis.end(), gui->getPriority(),
+		[](int priority, ofxDatGui * g) { return priority < g->getPriority(); });
+	mGuis.insert(it, gui);
+}
+
+void ofxDatGuiManager::add(ofxDatGui * gui) {
+	// a new gui opens on top and takes focus //
+	insertOnTop(gui);
+	mFocused = gui;
+}
+
+void ofxDatGuiManager::remove(ofxDatGui * gui) {
+	mGuis.erase(std::remove(mGuis.begin(), mGuis.end(), gui), mGuis.end());
+	// it may be gone by the time the update pass gets to it //
+	std::replace(mPass.begin(), mPass.end(), gui, (ofxDatGui *)nullptr);
+	if (mFocused == gui) mFocused = mGuis.size() > 0 ? mGuis[0] : nullptr;
+}
+
+void ofxDatGuiManager::focus(ofxDatGui * gui) {
+	auto it = std::find(mGuis.begin(), mGuis.end(), gui);
+	if (it == mGuis.end()) return;
+	mGuis.erase(it);
+	insertOnTop(gui);
+	mFocused = gui;
+}
+
+void ofxDatGuiManager::reorder(ofxDatGui * gui) {
+	auto it = std::find(mGuis.begin(), mGuis.end(), gui);
+	if (it == mGuis.end()) return;
+	mGuis.erase(it);
+	insertOnTop(gui);
+}
+
+void ofxDatGuiManager::resolveFocus() {
+	uint64_t frame = ofGetFrameNum();
+	if (mResolvedFrame == frame) return;
+	mResolvedFrame = frame;
+
+	const ofxDatGuiInput::Snapshot & input = ofxDatGuiInput::get();
+	if (!input.hasInput || !input.pressed) return;
+	// don't steal focus from a gui that is being dragged by its header //
+	if (mFocused != nullptr && mFocused->mMoving) return;
+	for (int i = (int)mGuis.size() - 1; i > -1; i--) {
+		// ignore guis that are invisible //
+		if (mGuis[i]->getVisible() && mGuis[i]->hitTest(input.mouse)) {
+			if (mGuis[i] != mFocused) mGuis[i]->focus();
+			break;
+		}
+	}
+}
+
+void ofxDatGuiManager::onUpdate(ofEventArgs & e) {
+	resolveFocus();
+	// top to bottom, so the gui in front resolves input first //
+	mPass = mGuis;
+	for (int i = (int)mPass.size() - 1; i > -1; i--) {
+		ofxDatGui * gui = mPass[i];
+		if (gui != nullptr && gui->getAutoDraw()) gui->update();
+	}
+	mPass.clear();
+}
+
+void ofxDatGuiManager::onDraw(ofEventArgs & e) {
+	// bottom to top //
+	for (auto gui : mGuis) {
+		if (gui->getAutoDraw()) gui->draw();
+	}
+}
+
+void ofxDatGuiManager::onWindowResized(ofResizeEventArgs & e) {
+	for (auto gui : mGuis) {
+		gui->onWindowResized(e);
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "ofMain.h"
+
+class ofxDatGui;
+
+// Owns the z-order of every ofxDatGui and drives them all from a single
+// update, draw and window resize listener.
+//
+// Focus is arbitrated once per frame: on a press the guis are hit tested
+// from the top down and the first one under the mouse is raised and
+// focused. Raising a gui only moves it inside the list below, no event
+// listener is ever removed or re-added.
+//
+// The list is sorted by gui priority (see ofxDatGui::setAutoDraw), a gui
+// is only ever raised to the top of the guis sharing its priority.
+//
+// Guis are updated from a copy of the list taken at the start of the
+// frame, event callbacks may focus, reorder, remove or delete guis while
+// it runs. A gui removed during the pass is skipped.
+class ofxDatGuiManager {
+public:
+	static ofxDatGuiManager & get();
+
+	void add(ofxDatGui * gui);
+	void remove(ofxDatGui * gui);
+	// Move gui to the top of the z-order and give it focus.
+	void focus(ofxDatGui * gui);
+	// Move gui into the z-order slot of its (changed) priority.
+	void reorder(ofxDatGui * gui);
+	// Run the per-frame hit test, safe to call more than once per frame.
+	void resolveFocus();
+
+	ofxDatGui * getFocused() const { return mFocused; }
+	// Bottom to top, the last gui is drawn last and gets input first.
+	const vector<ofxDatGui *> & getGuis() const { return mGuis; }
+
+private:
+	ofxDatGuiManager();
+
+	void insertOnTop(ofxDatGui * gui);
+
+	void onUpdate(ofEventArgs & e);
+	void onDraw(ofEventArgs & e);
+	void onWindowResized(ofResizeEventArgs & e);
+
+	vector<ofxDatGui *> mGuis;
+	vector<ofxDatGui *> mPass;
+	ofxDatGui * mFocused;
+	uint64_t mResolvedFrame;
+};